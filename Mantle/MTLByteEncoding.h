@@ -0,0 +1,82 @@
+//
+//  MTLByteEncoding.h
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <stdbool.h>
+#import <stddef.h>
+#import <stdint.h>
+#import "MTLDefines.h"
+
+// Kernels for converting between bytes and their textual representations.
+//
+// The kernels use SSE2 and SSSE3 where available, and fall back to portable
+// scalar code otherwise. They operate on ASCII characters, which makes them
+// suitable for the UTF-8 representation of a string.
+
+/// The alphabets understood by the base64 functions.
+///
+/// MTLBase64AlphabetStandard - The alphabet of RFC 4648, section 4, using `+`
+///                             and `/`. Output is padded with `=`.
+/// MTLBase64AlphabetURL      - The URL and filename safe alphabet of RFC 4648,
+///                             section 5, using `-` and `_`. Output is not
+///                             padded.
+typedef NS_ENUM(NSInteger, MTLBase64Alphabet) {
+	MTLBase64AlphabetStandard,
+	MTLBase64AlphabetURL,
+};
+
+/// Returns the number of characters needed to base64 encode `length` bytes.
+MANTLE_PRIVATE
+size_t MTLBase64EncodedLength(size_t length, MTLBase64Alphabet alphabet);
+
+/// Returns the maximum number of bytes decoded from `length` base64 characters.
+MANTLE_PRIVATE
+size_t MTLBase64MaximumDecodedLength(size_t length);
+
+/// Base64 encodes `length` bytes into `characters`, which must have room for
+/// MTLBase64EncodedLength() characters. No terminating NUL is written.
+///
+/// Returns the number of characters written.
+MANTLE_PRIVATE
+size_t MTLBase64Encode(const uint8_t *bytes, size_t length, char *characters, MTLBase64Alphabet alphabet);
+
+/// Decodes `length` base64 characters into `bytes`, which must have room for
+/// MTLBase64MaximumDecodedLength() bytes.
+///
+/// Padding is optional, but if present, must be correct.
+///
+/// decodedLength - Set to the number of bytes written if decoding succeeds.
+///
+/// Returns whether `characters` was valid base64 in the given alphabet.
+MANTLE_PRIVATE
+bool MTLBase64Decode(const char *characters, size_t length, uint8_t *bytes, size_t *decodedLength, MTLBase64Alphabet alphabet);
+
+/// Encodes `length` bytes into `2 * length` lowercase hexadecimal characters.
+/// No terminating NUL is written.
+MANTLE_PRIVATE
+void MTLHexEncode(const uint8_t *bytes, size_t length, char *characters);
+
+/// Decodes `length` hexadecimal characters of either case into `length / 2`
+/// bytes.
+///
+/// Returns whether `characters` was an even number of hexadecimal characters.
+MANTLE_PRIVATE
+bool MTLHexDecode(const char *characters, size_t length, uint8_t *bytes);
+
+/// The number of characters in the textual representation of a UUID.
+#define MTLUUIDStringLength 36
+
+/// Formats 16 bytes as a lowercase UUID string of MTLUUIDStringLength
+/// characters, as recommended by RFC 4122. No terminating NUL is written.
+MANTLE_PRIVATE
+void MTLUUIDEncode(const uint8_t *bytes, char *characters);
+
+/// Parses a UUID string of either case into 16 bytes.
+///
+/// Returns whether `characters` was a valid UUID string.
+MANTLE_PRIVATE
+bool MTLUUIDDecode(const char *characters, size_t length, uint8_t *bytes);
@@ -0,0 +1,329 @@
+//
+//  MTLByteEncoding.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLByteEncoding.h"
+#import <string.h>
+
+#if defined(__SSSE3__)
+#import <tmmintrin.h>
+#endif
+
+#if defined(__SSE2__)
+#import <emmintrin.h>
+#endif
+
+#pragma mark Base64
+
+static const char MTLBase64StandardCharacters[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char MTLBase64URLCharacters[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+static const uint8_t MTLBase64InvalidValue = 0xFF;
+
+// Returns the 6-bit value of a base64 character, or MTLBase64InvalidValue.
+static inline uint8_t MTLBase64Value(uint8_t character, MTLBase64Alphabet alphabet) {
+	if (character >= 'A' && character <= 'Z') return (uint8_t)(character - 'A');
+	if (character >= 'a' && character <= 'z') return (uint8_t)(character - 'a' + 26);
+	if (character >= '0' && character <= '9') return (uint8_t)(character - '0' + 52);
+
+	if (alphabet == MTLBase64AlphabetURL) {
+		if (character == '-') return 62;
+		if (character == '_') return 63;
+	} else {
+		if (character == '+') return 62;
+		if (character == '/') return 63;
+	}
+
+	return MTLBase64InvalidValue;
+}
+
+size_t MTLBase64EncodedLength(size_t length, MTLBase64Alphabet alphabet) {
+	if (alphabet == MTLBase64AlphabetURL) {
+		return (length / 3) * 4 + (length % 3 == 0 ? 0 : length % 3 + 1);
+	} else {
+		return ((length + 2) / 3) * 4;
+	}
+}
+
+size_t MTLBase64MaximumDecodedLength(size_t length) {
+	return (length / 4) * 3 + (length % 4) * 3 / 4;
+}
+
+size_t MTLBase64Encode(const uint8_t *bytes, size_t length, char *characters, MTLBase64Alphabet alphabet) {
+	const char *table = (alphabet == MTLBase64AlphabetURL ? MTLBase64URLCharacters : MTLBase64StandardCharacters);
+	char *output = characters;
+	size_t index = 0;
+
+#if defined(__SSSE3__)
+	// Each iteration loads 16 bytes but only consumes the first 12, which
+	// become 16 characters.
+	const __m128i shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+	const __m128i offsets = _mm_setr_epi8(
+		'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, table[62] - 62, table[63] - 63, 'A', 0, 0
+	);
+
+	for (; index + 16 <= length; index += 12) {
+		__m128i input = _mm_loadu_si128((const __m128i *)(bytes + index));
+		input = _mm_shuffle_epi8(input, shuffle);
+
+		// Spread each group of three bytes across four bytes of six bits.
+		__m128i high = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+		__m128i low = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+		__m128i values = _mm_or_si128(high, low);
+
+		// Map each value onto the offset that turns it into its character:
+		// 0-25 use slot 13, 26-51 slot 0, and 52-63 slots 1-12.
+		__m128i slots = _mm_subs_epu8(values, _mm_set1_epi8(51));
+		__m128i isUppercase = _mm_cmpgt_epi8(_mm_set1_epi8(26), values);
+		slots = _mm_or_si128(slots, _mm_and_si128(isUppercase, _mm_set1_epi8(13)));
+
+		__m128i encoded = _mm_add_epi8(_mm_shuffle_epi8(offsets, slots), values);
+		_mm_storeu_si128((__m128i *)output, encoded);
+		output += 16;
+	}
+#endif
+
+	for (; index + 3 <= length; index += 3) {
+		uint32_t group = (uint32_t)bytes[index] << 16 | (uint32_t)bytes[index + 1] << 8 | bytes[index + 2];
+		*output++ = table[(group >> 18) & 0x3F];
+		*output++ = table[(group >> 12) & 0x3F];
+		*output++ = table[(group >> 6) & 0x3F];
+		*output++ = table[group & 0x3F];
+	}
+
+	size_t remaining = length - index;
+	if (remaining > 0) {
+		uint32_t group = (uint32_t)bytes[index] << 16;
+		if (remaining == 2) group |= (uint32_t)bytes[index + 1] << 8;
+
+		*output++ = table[(group >> 18) & 0x3F];
+		*output++ = table[(group >> 12) & 0x3F];
+
+		if (remaining == 2) {
+			*output++ = table[(group >> 6) & 0x3F];
+		} else if (alphabet != MTLBase64AlphabetURL) {
+			*output++ = '=';
+		}
+
+		if (alphabet != MTLBase64AlphabetURL) *output++ = '=';
+	}
+
+	return (size_t)(output - characters);
+}
+
+bool MTLBase64Decode(const char *characters, size_t length, uint8_t *bytes, size_t *decodedLength, MTLBase64Alphabet alphabet) {
+	const uint8_t *input = (const uint8_t *)characters;
+
+	if (length > 0 && input[length - 1] == '=') {
+		if (length % 4 != 0) return false;
+
+		length--;
+		if (input[length - 1] == '=') length--;
+	}
+
+	if (length % 4 == 1) return false;
+
+	uint8_t *output = bytes;
+	size_t index = 0;
+
+#if defined(__SSSE3__)
+	// Validation and translation tables, indexed by the low and high nibbles
+	// of each character of the standard alphabet. A character is valid when
+	// its two validation entries share no bits.
+	const __m128i validLow = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+	const __m128i validHigh = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+	const __m128i offsets = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+	const __m128i zero = _mm_setzero_si128();
+
+	for (; index + 16 <= length; index += 16) {
+		__m128i chunk = _mm_loadu_si128((const __m128i *)(input + index));
+
+		if (alphabet == MTLBase64AlphabetURL) {
+			// Translate into the standard alphabet, rejecting its own
+			// characters for 62 and 63 first.
+			__m128i foreign = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('+')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('/')));
+			if (_mm_movemask_epi8(foreign) != 0) return false;
+
+			__m128i minus = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('-'));
+			__m128i underscore = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('_'));
+
+			chunk = _mm_andnot_si128(_mm_or_si128(minus, underscore), chunk);
+			chunk = _mm_or_si128(chunk, _mm_and_si128(minus, _mm_set1_epi8('+')));
+			chunk = _mm_or_si128(chunk, _mm_and_si128(underscore, _mm_set1_epi8('/')));
+		}
+
+		__m128i highNibbles = _mm_and_si128(_mm_srli_epi32(chunk, 4), _mm_set1_epi8(0x0F));
+		__m128i lowNibbles = _mm_and_si128(chunk, _mm_set1_epi8(0x0F));
+
+		__m128i invalid = _mm_and_si128(_mm_shuffle_epi8(validLow, lowNibbles), _mm_shuffle_epi8(validHigh, highNibbles));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(invalid, zero)) != 0xFFFF) return false;
+
+		// `/` shares its high nibble with `+` but needs a different offset.
+		__m128i isSlash = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('/'));
+		__m128i values = _mm_add_epi8(chunk, _mm_shuffle_epi8(offsets, _mm_add_epi8(isSlash, highNibbles)));
+
+		// Join each four values of six bits into three bytes.
+		__m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+		__m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+
+		uint8_t decoded[16];
+		_mm_storeu_si128((__m128i *)decoded, _mm_shuffle_epi8(groups, pack));
+		memcpy(output, decoded, 12);
+		output += 12;
+	}
+#endif
+
+	for (; index + 4 <= length; index += 4) {
+		uint8_t a = MTLBase64Value(input[index], alphabet);
+		uint8_t b = MTLBase64Value(input[index + 1], alphabet);
+		uint8_t c = MTLBase64Value(input[index + 2], alphabet);
+		uint8_t d = MTLBase64Value(input[index + 3], alphabet);
+		if (((a | b | c | d) & 0xC0) != 0) return false;
+
+		uint32_t group = (uint32_t)a << 18 | (uint32_t)b << 12 | (uint32_t)c << 6 | d;
+		*output++ = (uint8_t)(group >> 16);
+		*output++ = (uint8_t)(group >> 8);
+		*output++ = (uint8_t)group;
+	}
+
+	size_t remaining = length - index;
+	if (remaining > 0) {
+		uint8_t a = MTLBase64Value(input[index], alphabet);
+		uint8_t b = MTLBase64Value(input[index + 1], alphabet);
+		uint8_t c = (remaining == 3 ? MTLBase64Value(input[index + 2], alphabet) : 0);
+		if (((a | b | c) & 0xC0) != 0) return false;
+
+		uint32_t group = (uint32_t)a << 18 | (uint32_t)b << 12 | (uint32_t)c << 6;
+		*output++ = (uint8_t)(group >> 16);
+		if (remaining == 3) *output++ = (uint8_t)(group >> 8);
+	}
+
+	*decodedLength = (size_t)(output - bytes);
+	return true;
+}
+
+#pragma mark Hexadecimal
+
+static const char MTLHexCharacters[] = "0123456789abcdef";
+
+// Returns the value of a hexadecimal digit, or 0xFF if the character isn't
+// one.
+static inline uint8_t MTLHexValue(uint8_t character) {
+	if (character >= '0' && character <= '9') return (uint8_t)(character - '0');
+
+	uint8_t lowercase = character | 0x20;
+	if (lowercase >= 'a' && lowercase <= 'f') return (uint8_t)(lowercase - 'a' + 10);
+
+	return 0xFF;
+}
+
+void MTLHexEncode(const uint8_t *bytes, size_t length, char *characters) {
+	size_t index = 0;
+
+#if defined(__SSE2__)
+	const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+	const __m128i nine = _mm_set1_epi8(9);
+	const __m128i letterOffset = _mm_set1_epi8('a' - '0' - 10);
+	const __m128i digitOffset = _mm_set1_epi8('0');
+
+	for (; index + 16 <= length; index += 16) {
+		__m128i input = _mm_loadu_si128((const __m128i *)(bytes + index));
+		__m128i high = _mm_and_si128(_mm_srli_epi16(input, 4), nibbleMask);
+		__m128i low = _mm_and_si128(input, nibbleMask);
+
+		__m128i first = _mm_unpacklo_epi8(high, low);
+		__m128i second = _mm_unpackhi_epi8(high, low);
+
+		first = _mm_add_epi8(_mm_add_epi8(first, digitOffset), _mm_and_si128(_mm_cmpgt_epi8(first, nine), letterOffset));
+		second = _mm_add_epi8(_mm_add_epi8(second, digitOffset), _mm_and_si128(_mm_cmpgt_epi8(second, nine), letterOffset));
+
+		_mm_storeu_si128((__m128i *)(characters + index * 2), first);
+		_mm_storeu_si128((__m128i *)(characters + index * 2 + 16), second);
+	}
+#endif
+
+	for (; index < length; index++) {
+		characters[index * 2] = MTLHexCharacters[bytes[index] >> 4];
+		characters[index * 2 + 1] = MTLHexCharacters[bytes[index] & 0x0F];
+	}
+}
+
+bool MTLHexDecode(const char *characters, size_t length, uint8_t *bytes) {
+	if (length % 2 != 0) return false;
+
+	const uint8_t *input = (const uint8_t *)characters;
+	size_t index = 0;
+
+#if defined(__SSE2__)
+	// Comparisons are signed, so characters outside of ASCII compare below
+	// every range and are rejected along with everything else.
+	const __m128i caseBit = _mm_set1_epi8(0x20);
+
+	for (; index + 16 <= length; index += 16) {
+		__m128i chunk = _mm_loadu_si128((const __m128i *)(input + index));
+		__m128i lowercase = _mm_or_si128(chunk, caseBit);
+
+		__m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(chunk, _mm_set1_epi8('9' + 1)));
+		__m128i isLetter = _mm_and_si128(_mm_cmpgt_epi8(lowercase, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lowercase, _mm_set1_epi8('f' + 1)));
+		if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xFFFF) return false;
+
+		__m128i nibbles = _mm_or_si128(
+			_mm_and_si128(isDigit, _mm_sub_epi8(chunk, _mm_set1_epi8('0'))),
+			_mm_and_si128(isLetter, _mm_sub_epi8(lowercase, _mm_set1_epi8('a' - 10)))
+		);
+
+		// Even characters hold the high nibble of each byte, and odd
+		// characters the low nibble.
+		__m128i high = _mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00FF)), 4);
+		__m128i low = _mm_srli_epi16(nibbles, 8);
+		__m128i packed = _mm_packus_epi16(_mm_or_si128(high, low), _mm_setzero_si128());
+
+		_mm_storel_epi64((__m128i *)(bytes + index / 2), packed);
+	}
+#endif
+
+	for (; index < length; index += 2) {
+		uint8_t high = MTLHexValue(input[index]);
+		uint8_t low = MTLHexValue(input[index + 1]);
+		if (((high | low) & 0xF0) != 0) return false;
+
+		bytes[index / 2] = (uint8_t)(high << 4 | low);
+	}
+
+	return true;
+}
+
+#pragma mark UUIDs
+
+// The number of bytes in each hyphen-separated group of a UUID string.
+static const size_t MTLUUIDGroupLengths[] = { 4, 2, 2, 2, 6 };
+
+void MTLUUIDEncode(const uint8_t *bytes, char *characters) {
+	for (size_t group = 0; group < sizeof(MTLUUIDGroupLengths) / sizeof(*MTLUUIDGroupLengths); group++) {
+		if (group > 0) *characters++ = '-';
+
+		MTLHexEncode(bytes, MTLUUIDGroupLengths[group], characters);
+		bytes += MTLUUIDGroupLengths[group];
+		characters += MTLUUIDGroupLengths[group] * 2;
+	}
+}
+
+bool MTLUUIDDecode(const char *characters, size_t length, uint8_t *bytes) {
+	if (length != MTLUUIDStringLength) return false;
+
+	for (size_t group = 0; group < sizeof(MTLUUIDGroupLengths) / sizeof(*MTLUUIDGroupLengths); group++) {
+		if (group > 0 && *characters++ != '-') return false;
+
+		if (!MTLHexDecode(characters, MTLUUIDGroupLengths[group] * 2, bytes)) return false;
+		bytes += MTLUUIDGroupLengths[group];
+		characters += MTLUUIDGroupLengths[group] * 2;
+	}
+
+	return true;
+}
@@ -0,0 +1,33 @@
+//
+//  MTLCanonicalJSON.h
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "MTLDefines.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Encodes a JSON object in the canonical form of RFC 8785 (JSON Canonicalization
+// Scheme), so that equal objects always produce the same bytes.
+//
+// Object members are sorted by the UTF-16 code units of their keys, numbers are
+// written in their shortest round-tripping form as ECMAScript does, strings
+// only escape what JSON requires, and no whitespace is written. The output is
+// UTF-8.
+//
+// object        - An NSDictionary with NSString keys, NSArray, NSString,
+//                 NSNumber or NSNull, containing only objects of these classes.
+// invalidObject - If not NULL, set to the object which could not be encoded if
+//                 encoding fails. This is an object of an unsupported class, a
+//                 non-finite number, an integer which a double can't represent
+//                 exactly, or a string which isn't valid Unicode.
+//
+// Returns the encoded bytes, or nil if `object` could not be encoded.
+MANTLE_PRIVATE
+NSData * _Nullable MTLCanonicalJSONDataWithObject(id object, id _Nullable __autoreleasing * _Nullable invalidObject);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,276 @@
+//
+//  MTLCanonicalJSON.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLCanonicalJSON.h"
+#import <limits.h>
+#import <math.h>
+#import <stdio.h>
+#import <stdlib.h>
+#import <string.h>
+
+// A growing buffer of output bytes.
+typedef struct {
+	uint8_t *bytes;
+	size_t length;
+	size_t capacity;
+} MTLCanonicalJSONBuffer;
+
+static void MTLCanonicalJSONReserve(MTLCanonicalJSONBuffer *buffer, size_t length) {
+	if (buffer->length + length <= buffer->capacity) return;
+
+	size_t capacity = MAX(buffer->capacity * 2, buffer->length + length);
+	buffer->bytes = reallocf(buffer->bytes, capacity);
+	if (buffer->bytes == NULL) abort();
+
+	buffer->capacity = capacity;
+}
+
+static inline void MTLCanonicalJSONAppendBytes(MTLCanonicalJSONBuffer *buffer, const void *bytes, size_t length) {
+	MTLCanonicalJSONReserve(buffer, length);
+
+	memcpy(buffer->bytes + buffer->length, bytes, length);
+	buffer->length += length;
+}
+
+static inline void MTLCanonicalJSONAppendByte(MTLCanonicalJSONBuffer *buffer, uint8_t byte) {
+	MTLCanonicalJSONReserve(buffer, 1);
+
+	buffer->bytes[buffer->length++] = byte;
+}
+
+static BOOL MTLCanonicalJSONAppendString(MTLCanonicalJSONBuffer *buffer, NSString *string) {
+	static const char hexDigits[] = "0123456789abcdef";
+
+	CFStringRef CFString = (__bridge CFStringRef)string;
+	CFIndex length = CFStringGetLength(CFString);
+
+	// Convert into a scratch buffer first, since escaping may grow the output.
+	uint8_t stackBytes[256];
+	CFIndex maximumByteCount = CFStringGetMaximumSizeForEncoding(length, kCFStringEncodingUTF8);
+	uint8_t *bytes = (maximumByteCount <= (CFIndex)sizeof(stackBytes) ? stackBytes : malloc((size_t)maximumByteCount));
+	if (bytes == NULL) abort();
+
+	// Strings with unpaired surrogates have no UTF-8 representation, so the
+	// conversion stops short of them.
+	CFIndex byteCount = 0;
+	CFIndex convertedLength = CFStringGetBytes(CFString, CFRangeMake(0, length), kCFStringEncodingUTF8, 0, false, bytes, maximumByteCount, &byteCount);
+
+	if (convertedLength != length) {
+		if (bytes != stackBytes) free(bytes);
+		return NO;
+	}
+
+	MTLCanonicalJSONAppendByte(buffer, '"');
+
+	const uint8_t *run = bytes;
+	const uint8_t *end = bytes + byteCount;
+	const uint8_t *current = run;
+
+	for (; current < end; current++) {
+		uint8_t byte = *current;
+		if (byte >= 0x20 && byte != '"' && byte != '\\') continue;
+
+		MTLCanonicalJSONAppendBytes(buffer, run, (size_t)(current - run));
+		run = current + 1;
+
+		switch (byte) {
+			case '"': MTLCanonicalJSONAppendBytes(buffer, "\\\"", 2); break;
+			case '\\': MTLCanonicalJSONAppendBytes(buffer, "\\\\", 2); break;
+			case '\b': MTLCanonicalJSONAppendBytes(buffer, "\\b", 2); break;
+			case '\f': MTLCanonicalJSONAppendBytes(buffer, "\\f", 2); break;
+			case '\n': MTLCanonicalJSONAppendBytes(buffer, "\\n", 2); break;
+			case '\r': MTLCanonicalJSONAppendBytes(buffer, "\\r", 2); break;
+			case '\t': MTLCanonicalJSONAppendBytes(buffer, "\\t", 2); break;
+
+			default: {
+				char escape[6] = { '\\', 'u', '0', '0', hexDigits[byte >> 4], hexDigits[byte & 0xF] };
+				MTLCanonicalJSONAppendBytes(buffer, escape, sizeof(escape));
+			}
+		}
+	}
+
+	MTLCanonicalJSONAppendBytes(buffer, run, (size_t)(current - run));
+	MTLCanonicalJSONAppendByte(buffer, '"');
+
+	if (bytes != stackBytes) free(bytes);
+
+	return YES;
+}
+
+// Writes `value` like ECMAScript's Number.prototype.toString(), which RFC 8785
+// requires.
+static BOOL MTLCanonicalJSONAppendDouble(MTLCanonicalJSONBuffer *buffer, double value) {
+	if (!isfinite(value)) return NO;
+
+	char string[32];
+
+	// Integers are by far the most common, and need no search for the shortest
+	// representation.
+	if (value == trunc(value) && fabs(value) < 0x1p53) {
+		int length = snprintf(string, sizeof(string), "%lld", (long long)value);
+		MTLCanonicalJSONAppendBytes(buffer, string, (size_t)length);
+		return YES;
+	}
+
+	if (value < 0) {
+		MTLCanonicalJSONAppendByte(buffer, '-');
+		value = -value;
+	}
+
+	// Find the fewest significant digits which read back as the same value.
+	char scientific[32];
+	for (int precision = 0; precision <= 16; precision++) {
+		snprintf(scientific, sizeof(scientific), "%.*e", precision, value);
+		if (strtod(scientific, NULL) == value) break;
+	}
+
+	// Split "d.ddde+XX" into its digits and exponent.
+	char digits[20];
+	size_t digitCount = 0;
+	const char *character = scientific;
+
+	for (; *character != 'e'; character++) {
+		if (*character != '.') digits[digitCount++] = *character;
+	}
+
+	int exponent = atoi(character + 1);
+
+	// Drop trailing zeros, which %e may produce for precision 0 or when the
+	// shortest representation has them.
+	while (digitCount > 1 && digits[digitCount - 1] == '0') digitCount--;
+
+	// The position of the decimal point relative to the digits.
+	int point = exponent + 1;
+
+	if ((int)digitCount <= point && point <= 21) {
+		MTLCanonicalJSONAppendBytes(buffer, digits, digitCount);
+		for (int i = (int)digitCount; i < point; i++) MTLCanonicalJSONAppendByte(buffer, '0');
+	} else if (0 < point && point <= 21) {
+		MTLCanonicalJSONAppendBytes(buffer, digits, (size_t)point);
+		MTLCanonicalJSONAppendByte(buffer, '.');
+		MTLCanonicalJSONAppendBytes(buffer, digits + point, digitCount - (size_t)point);
+	} else if (-6 < point && point <= 0) {
+		MTLCanonicalJSONAppendBytes(buffer, "0.", 2);
+		for (int i = point; i < 0; i++) MTLCanonicalJSONAppendByte(buffer, '0');
+		MTLCanonicalJSONAppendBytes(buffer, digits, digitCount);
+	} else {
+		MTLCanonicalJSONAppendByte(buffer, (uint8_t)digits[0]);
+
+		if (digitCount > 1) {
+			MTLCanonicalJSONAppendByte(buffer, '.');
+			MTLCanonicalJSONAppendBytes(buffer, digits + 1, digitCount - 1);
+		}
+
+		int length = snprintf(string, sizeof(string), "e%c%d", (point - 1 < 0 ? '-' : '+'), abs(point - 1));
+		MTLCanonicalJSONAppendBytes(buffer, string, (size_t)length);
+	}
+
+	return YES;
+}
+
+static BOOL MTLCanonicalJSONAppendNumber(MTLCanonicalJSONBuffer *buffer, NSNumber *number) {
+	if (CFGetTypeID((__bridge CFTypeRef)number) == CFBooleanGetTypeID()) {
+		if (number.boolValue) {
+			MTLCanonicalJSONAppendBytes(buffer, "true", 4);
+		} else {
+			MTLCanonicalJSONAppendBytes(buffer, "false", 5);
+		}
+
+		return YES;
+	}
+
+	if (CFNumberIsFloatType((__bridge CFNumberRef)number)) {
+		return MTLCanonicalJSONAppendDouble(buffer, number.doubleValue);
+	}
+
+	// RFC 8785 writes every number as a double, so integers which doubles can't
+	// represent exactly are rejected rather than silently rounded.
+	double value;
+
+	if (strcmp(number.objCType, @encode(unsigned long long)) == 0 && number.unsignedLongLongValue > LLONG_MAX) {
+		unsigned long long integer = number.unsignedLongLongValue;
+		value = (double)integer;
+
+		if (value >= 0x1p64 || (unsigned long long)value != integer) return NO;
+	} else {
+		long long integer = number.longLongValue;
+		value = (double)integer;
+
+		if (value >= 0x1p63 || (long long)value != integer) return NO;
+	}
+
+	return MTLCanonicalJSONAppendDouble(buffer, value);
+}
+
+static BOOL MTLCanonicalJSONAppendObject(MTLCanonicalJSONBuffer *buffer, id object, id __autoreleasing *invalidObject) {
+	BOOL success = YES;
+
+	if ([object isKindOfClass:NSString.class]) {
+		success = MTLCanonicalJSONAppendString(buffer, object);
+	} else if ([object isKindOfClass:NSNumber.class]) {
+		success = MTLCanonicalJSONAppendNumber(buffer, object);
+	} else if (object == NSNull.null) {
+		MTLCanonicalJSONAppendBytes(buffer, "null", 4);
+	} else if ([object isKindOfClass:NSDictionary.class]) {
+		NSArray *keys = [[object allKeys] sortedArrayUsingComparator:^(id key, id otherKey) {
+			// Non-string keys are reported below.
+			if (![key isKindOfClass:NSString.class] || ![otherKey isKindOfClass:NSString.class]) return NSOrderedSame;
+
+			return [key compare:otherKey options:NSLiteralSearch];
+		}];
+
+		MTLCanonicalJSONAppendByte(buffer, '{');
+
+		BOOL first = YES;
+		for (id key in keys) {
+			if (!first) MTLCanonicalJSONAppendByte(buffer, ',');
+			first = NO;
+
+			if (![key isKindOfClass:NSString.class] || !MTLCanonicalJSONAppendString(buffer, key)) {
+				if (invalidObject != NULL) *invalidObject = key;
+				return NO;
+			}
+
+			MTLCanonicalJSONAppendByte(buffer, ':');
+
+			if (!MTLCanonicalJSONAppendObject(buffer, [object objectForKey:key], invalidObject)) return NO;
+		}
+
+		MTLCanonicalJSONAppendByte(buffer, '}');
+	} else if ([object isKindOfClass:NSArray.class]) {
+		MTLCanonicalJSONAppendByte(buffer, '[');
+
+		BOOL first = YES;
+		for (id element in object) {
+			if (!first) MTLCanonicalJSONAppendByte(buffer, ',');
+			first = NO;
+
+			if (!MTLCanonicalJSONAppendObject(buffer, element, invalidObject)) return NO;
+		}
+
+		MTLCanonicalJSONAppendByte(buffer, ']');
+	} else {
+		success = NO;
+	}
+
+	if (!success && invalidObject != NULL) *invalidObject = object;
+
+	return success;
+}
+
+NSData *MTLCanonicalJSONDataWithObject(id object, id __autoreleasing *invalidObject) {
+	MTLCanonicalJSONBuffer buffer = { .bytes = NULL, .length = 0, .capacity = 0 };
+	MTLCanonicalJSONReserve(&buffer, 256);
+
+	if (!MTLCanonicalJSONAppendObject(&buffer, object, invalidObject)) {
+		free(buffer.bytes);
+		return nil;
+	}
+
+	return [NSData dataWithBytesNoCopy:buffer.bytes length:buffer.length freeWhenDone:YES];
+}
@@ -0,0 +1,119 @@
+//
+//  MTLColumnarModelArray.h
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class MTLColumnarModelRow;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Holds many models of the same class decoded by an MTLJSONAdapter, storing
+/// the values of each property together instead of allocating an object per
+/// model.
+///
+/// Properties of integer, floating-point or BOOL type are stored as contiguous
+/// C arrays, which can be read in bulk through -bytesOfColumnForPropertyKey:.
+/// All other properties are stored as arrays of objects. Only the properties
+/// in +JSONKeyPathsByPropertyKey of the model class are stored.
+///
+/// Individual models can be read through lightweight views returned by
+/// -rowAtIndex:, or turned into real models with -modelAtIndex:error:.
+///
+/// Arrays are created with -[MTLJSONAdapter
+/// columnarModelArrayFromJSONArray:fieldMask:error:] and never change
+/// afterwards, so they may be read from multiple threads at once.
+@interface MTLColumnarModelArray<__covariant Model> : NSObject
+
+/// The class of the models in the receiver.
+@property (nonatomic, strong, readonly) Class modelClass;
+
+/// The number of models in the receiver.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/// The keys of the properties stored by the receiver, in sorted order.
+@property (nonatomic, copy, readonly) NSArray<NSString *> *propertyKeys;
+
+/// Returns the value of a property of one model, boxed the same way key-value
+/// coding boxes it, or nil if it is nil.
+///
+/// propertyKey - One of `propertyKeys`.
+/// index       - The index of the model. This must be less than `count`.
+- (nullable id)valueForPropertyKey:(NSString *)propertyKey atIndex:(NSUInteger)index;
+
+/// Returns the type encoding of the values stored for a property, as returned
+/// by the @encode() directive, like "d" for a double. All properties stored as
+/// objects return @encode(id).
+///
+/// propertyKey - One of `propertyKeys`.
+- (const char *)objCTypeOfColumnForPropertyKey:(NSString *)propertyKey NS_RETURNS_INNER_POINTER;
+
+/// Returns the `count` values of a property stored as a C array, or NULL if the
+/// property is stored as objects.
+///
+/// The type of the values is given by -objCTypeOfColumnForPropertyKey:. The
+/// returned pointer is valid for as long as the receiver.
+///
+/// propertyKey - One of `propertyKeys`.
+- (nullable const void *)bytesOfColumnForPropertyKey:(NSString *)propertyKey NS_RETURNS_INNER_POINTER;
+
+/// Returns the values of a property of all models, with NSNull in place of nil
+/// and numbers boxed as NSNumbers.
+///
+/// propertyKey - One of `propertyKeys`.
+- (NSArray *)objectsOfColumnForPropertyKey:(NSString *)propertyKey;
+
+/// Returns a view of the model at the given index.
+///
+/// Views only hold on to the receiver and the index, so creating them is cheap.
+///
+/// index - The index of the model. This must be less than `count`.
+- (MTLColumnarModelRow *)rowAtIndex:(NSUInteger)index;
+
+/// Equivalent to -rowAtIndex:.
+- (MTLColumnarModelRow *)objectAtIndexedSubscript:(NSUInteger)index;
+
+/// Creates a model of `modelClass` with the values at the given index.
+///
+/// Values are validated as they are set, and -validate: is called on the model
+/// afterwards, just as if it had been decoded by an MTLJSONAdapter. Like models
+/// decoded with a field mask, models of arrays decoded with one are not
+/// validated as a whole, since they lack the other properties. Every call
+/// creates a new model.
+///
+/// index - The index of the model. This must be less than `count`.
+/// error - If not NULL, this may be set to an error that occurs during
+///         initialization or validation.
+///
+/// Returns a new model, or nil if an error occurred.
+- (nullable Model)modelAtIndex:(NSUInteger)index error:(NSError **)error;
+
+@end
+
+/// A view of one model in an MTLColumnarModelArray.
+///
+/// Property values can be read with -valueForKey: or keyed subscripts, like
+/// `row[@"count"]`.
+@interface MTLColumnarModelRow : NSObject
+
+/// The array containing the model.
+@property (nonatomic, strong, readonly) MTLColumnarModelArray *modelArray;
+
+/// The index of the model in `modelArray`.
+@property (nonatomic, assign, readonly) NSUInteger index;
+
+/// Returns the value of a property of the model, like
+/// -[MTLColumnarModelArray valueForPropertyKey:atIndex:].
+- (nullable id)objectForKeyedSubscript:(NSString *)propertyKey;
+
+/// Creates a model with the values of the receiver, like
+/// -[MTLColumnarModelArray modelAtIndex:error:].
+- (nullable id)modelWithError:(NSError **)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,346 @@
+//
+//  MTLColumnarModelArray.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <objc/runtime.h>
+
+#import <Mantle/EXTRuntimeExtensions.h>
+#import <Mantle/EXTScope.h>
+#import "MTLColumnarModelArray_Private.h"
+#import "MTLModel.h"
+#import "MTLModel+ChangeTracking.h"
+
+// Returns the type encoding that values of properties of the given type are
+// stored as, which is @encode(id) unless they can be stored as a C array.
+static const char *MTLColumnObjCTypeForPropertyType(const char *type) {
+	if (type[0] == '\0' || type[1] != '\0') return @encode(id);
+
+	switch (type[0]) {
+		case 'B': return @encode(bool);
+		case 'c': return @encode(char);
+		case 'C': return @encode(unsigned char);
+		case 's': return @encode(short);
+		case 'S': return @encode(unsigned short);
+		case 'i': return @encode(int);
+		case 'I': return @encode(unsigned int);
+		case 'l': return @encode(long);
+		case 'L': return @encode(unsigned long);
+		case 'q': return @encode(long long);
+		case 'Q': return @encode(unsigned long long);
+		case 'f': return @encode(float);
+		case 'd': return @encode(double);
+		default: return @encode(id);
+	}
+}
+
+// Returns the size of a value of a type returned by
+// MTLColumnObjCTypeForPropertyType(), or 0 for @encode(id).
+static size_t MTLColumnElementSizeForObjCType(const char *objCType) {
+	switch (objCType[0]) {
+		case 'B': return sizeof(bool);
+		case 'c': return sizeof(char);
+		case 'C': return sizeof(unsigned char);
+		case 's': return sizeof(short);
+		case 'S': return sizeof(unsigned short);
+		case 'i': return sizeof(int);
+		case 'I': return sizeof(unsigned int);
+		case 'l': return sizeof(long);
+		case 'L': return sizeof(unsigned long);
+		case 'q': return sizeof(long long);
+		case 'Q': return sizeof(unsigned long long);
+		case 'f': return sizeof(float);
+		case 'd': return sizeof(double);
+		default: return 0;
+	}
+}
+
+// The values of one property of all models in an MTLColumnarModelArray.
+@interface MTLColumnarModelColumn : NSObject
+
+// The type of the values, which is @encode(id) for columns of objects.
+@property (nonatomic, assign, readonly) const char *objCType;
+
+// The size of each value in `data`, or 0 for columns of objects.
+@property (nonatomic, assign, readonly) size_t elementSize;
+
+// The values of columns stored as a C array, or nil.
+@property (nonatomic, strong, readonly) NSMutableData *data;
+
+// The values of columns of objects, with NSNull in place of nil, or nil.
+@property (nonatomic, strong, readonly) NSMutableArray *objects;
+
+- (instancetype)initWithObjCType:(const char *)objCType capacity:(NSUInteger)capacity;
+
+@end
+
+@interface MTLColumnarModelRow ()
+
+- (instancetype)initWithModelArray:(MTLColumnarModelArray *)modelArray index:(NSUInteger)index;
+
+@end
+
+@interface MTLColumnarModelArray ()
+
+// The columns of `propertyKeys`, in the same order.
+@property (nonatomic, copy, readonly) NSArray *columns;
+
+// The objects of `columns`, keyed by property key.
+@property (nonatomic, copy, readonly) NSDictionary *columnsByPropertyKey;
+
+// Whether -modelAtIndex:error: calls -validate: on the models it creates.
+@property (nonatomic, assign, readonly) BOOL validatesModels;
+
+@end
+
+@implementation MTLColumnarModelArray
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithModelClass:(Class)modelClass propertyKeys:(NSArray *)propertyKeys capacity:(NSUInteger)capacity validatesModels:(BOOL)validatesModels {
+	NSParameterAssert(modelClass != nil);
+	NSParameterAssert(propertyKeys != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_modelClass = modelClass;
+	_propertyKeys = [propertyKeys copy];
+	_validatesModels = validatesModels;
+
+	NSMutableArray *columns = [NSMutableArray arrayWithCapacity:propertyKeys.count];
+
+	for (NSString *propertyKey in propertyKeys) {
+		const char *objCType = @encode(id);
+
+		objc_property_t property = class_getProperty(modelClass, propertyKey.UTF8String);
+
+		if (property != NULL) {
+			mtl_propertyAttributes *attributes = mtl_copyPropertyAttributes(property);
+			@onExit {
+				free(attributes);
+			};
+
+			objCType = MTLColumnObjCTypeForPropertyType(attributes->type);
+		}
+
+		[columns addObject:[[MTLColumnarModelColumn alloc] initWithObjCType:objCType capacity:capacity]];
+	}
+
+	_columns = [columns copy];
+	_columnsByPropertyKey = [NSDictionary dictionaryWithObjects:_columns forKeys:_propertyKeys];
+
+	return self;
+}
+
+- (void)appendRow {
+	for (MTLColumnarModelColumn *column in self.columns) {
+		if (column.data != nil) {
+			[column.data increaseLengthBy:column.elementSize];
+		} else {
+			[column.objects addObject:NSNull.null];
+		}
+	}
+
+	_count++;
+}
+
+- (BOOL)setValue:(id)value forColumnAtIndex:(NSUInteger)columnIndex {
+	NSParameterAssert(self.count > 0);
+
+	MTLColumnarModelColumn *column = self.columns[columnIndex];
+
+	if (column.data == nil) {
+		column.objects[self.count - 1] = value ?: NSNull.null;
+		return YES;
+	}
+
+	if (value == nil || value == NSNull.null) return YES;
+	if (![value isKindOfClass:NSNumber.class]) return NO;
+
+	NSNumber *number = value;
+	void *bytes = (char *)column.data.mutableBytes + (self.count - 1) * column.elementSize;
+
+	switch (column.objCType[0]) {
+		case 'B': *(bool *)bytes = number.boolValue; break;
+		case 'c': *(char *)bytes = number.charValue; break;
+		case 'C': *(unsigned char *)bytes = number.unsignedCharValue; break;
+		case 's': *(short *)bytes = number.shortValue; break;
+		case 'S': *(unsigned short *)bytes = number.unsignedShortValue; break;
+		case 'i': *(int *)bytes = number.intValue; break;
+		case 'I': *(unsigned int *)bytes = number.unsignedIntValue; break;
+		case 'l': *(long *)bytes = number.longValue; break;
+		case 'L': *(unsigned long *)bytes = number.unsignedLongValue; break;
+		case 'q': *(long long *)bytes = number.longLongValue; break;
+		case 'Q': *(unsigned long long *)bytes = number.unsignedLongLongValue; break;
+		case 'f': *(float *)bytes = number.floatValue; break;
+		case 'd': *(double *)bytes = number.doubleValue; break;
+	}
+
+	return YES;
+}
+
+#pragma mark Columns
+
+- (MTLColumnarModelColumn *)columnForPropertyKey:(NSString *)propertyKey {
+	MTLColumnarModelColumn *column = self.columnsByPropertyKey[propertyKey];
+	NSAssert(column != nil, @"%@ is not a property stored by %@", propertyKey, self);
+
+	return column;
+}
+
+- (id)valueForPropertyKey:(NSString *)propertyKey atIndex:(NSUInteger)index {
+	NSParameterAssert(index < self.count);
+
+	MTLColumnarModelColumn *column = [self columnForPropertyKey:propertyKey];
+
+	if (column.data == nil) {
+		id value = column.objects[index];
+		return (value == NSNull.null ? nil : value);
+	}
+
+	const void *bytes = (const char *)column.data.bytes + index * column.elementSize;
+
+	switch (column.objCType[0]) {
+		case 'B': return @(*(const bool *)bytes);
+		case 'c': return @(*(const char *)bytes);
+		case 'C': return @(*(const unsigned char *)bytes);
+		case 's': return @(*(const short *)bytes);
+		case 'S': return @(*(const unsigned short *)bytes);
+		case 'i': return @(*(const int *)bytes);
+		case 'I': return @(*(const unsigned int *)bytes);
+		case 'l': return @(*(const long *)bytes);
+		case 'L': return @(*(const unsigned long *)bytes);
+		case 'q': return @(*(const long long *)bytes);
+		case 'Q': return @(*(const unsigned long long *)bytes);
+		case 'f': return @(*(const float *)bytes);
+		case 'd': return @(*(const double *)bytes);
+		default: return nil;
+	}
+}
+
+- (const char *)objCTypeOfColumnForPropertyKey:(NSString *)propertyKey {
+	return [self columnForPropertyKey:propertyKey].objCType;
+}
+
+- (const void *)bytesOfColumnForPropertyKey:(NSString *)propertyKey {
+	return [self columnForPropertyKey:propertyKey].data.bytes;
+}
+
+- (NSArray *)objectsOfColumnForPropertyKey:(NSString *)propertyKey {
+	MTLColumnarModelColumn *column = [self columnForPropertyKey:propertyKey];
+	if (column.data == nil) return [column.objects copy];
+
+	NSMutableArray *objects = [NSMutableArray arrayWithCapacity:self.count];
+
+	for (NSUInteger index = 0; index < self.count; index++) {
+		[objects addObject:[self valueForPropertyKey:propertyKey atIndex:index]];
+	}
+
+	return objects;
+}
+
+#pragma mark Rows
+
+- (MTLColumnarModelRow *)rowAtIndex:(NSUInteger)index {
+	NSParameterAssert(index < self.count);
+
+	return [[MTLColumnarModelRow alloc] initWithModelArray:self index:index];
+}
+
+- (MTLColumnarModelRow *)objectAtIndexedSubscript:(NSUInteger)index {
+	return [self rowAtIndex:index];
+}
+
+- (id)modelAtIndex:(NSUInteger)index error:(NSError **)error {
+	NSParameterAssert(index < self.count);
+
+	NSMutableDictionary *dictionaryValue = [NSMutableDictionary dictionaryWithCapacity:self.propertyKeys.count];
+
+	for (NSString *propertyKey in self.propertyKeys) {
+		dictionaryValue[propertyKey] = [self valueForPropertyKey:propertyKey atIndex:index] ?: NSNull.null;
+	}
+
+	id model = [self.modelClass modelWithDictionary:dictionaryValue error:error];
+	if (model == nil) return nil;
+
+	// Models of masked arrays lack the properties outside the mask.
+	if (self.validatesModels && ![model validate:error]) return nil;
+
+	if ([model isKindOfClass:MTLModel.class] && [[model class] tracksChanges]) [model checkpointChanges];
+
+	return model;
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> modelClass: %@, count: %lu", self.class, self, self.modelClass, (unsigned long)self.count];
+}
+
+@end
+
+@implementation MTLColumnarModelColumn
+
+- (instancetype)initWithObjCType:(const char *)objCType capacity:(NSUInteger)capacity {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_objCType = objCType;
+	_elementSize = MTLColumnElementSizeForObjCType(objCType);
+
+	if (_elementSize > 0) {
+		_data = [[NSMutableData alloc] initWithCapacity:capacity * _elementSize];
+	} else {
+		_objects = [[NSMutableArray alloc] initWithCapacity:capacity];
+	}
+
+	return self;
+}
+
+@end
+
+@implementation MTLColumnarModelRow
+
+- (instancetype)initWithModelArray:(MTLColumnarModelArray *)modelArray index:(NSUInteger)index {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_modelArray = modelArray;
+	_index = index;
+
+	return self;
+}
+
+- (id)objectForKeyedSubscript:(NSString *)propertyKey {
+	return [self.modelArray valueForPropertyKey:propertyKey atIndex:self.index];
+}
+
+- (id)modelWithError:(NSError **)error {
+	return [self.modelArray modelAtIndex:self.index error:error];
+}
+
+#pragma mark NSKeyValueCoding
+
+- (id)valueForKey:(NSString *)key {
+	if (self.modelArray.columnsByPropertyKey[key] == nil) return [super valueForKey:key];
+
+	return [self.modelArray valueForPropertyKey:key atIndex:self.index];
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	NSMutableDictionary *values = [NSMutableDictionary dictionaryWithCapacity:self.modelArray.propertyKeys.count];
+
+	for (NSString *propertyKey in self.modelArray.propertyKeys) {
+		values[propertyKey] = self[propertyKey] ?: NSNull.null;
+	}
+
+	return [NSString stringWithFormat:@"<%@: %p> index: %lu, values: %@", self.class, self, (unsigned long)self.index, values];
+}
+
+@end
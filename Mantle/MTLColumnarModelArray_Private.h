@@ -0,0 +1,41 @@
+//
+//  MTLColumnarModelArray_Private.h
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLColumnarModelArray.h"
+
+@interface MTLColumnarModelArray ()
+
+// Initializes an empty array storing the given properties of `modelClass`.
+//
+// modelClass      - The class of the models to store. This argument must not
+//                   be nil.
+// propertyKeys    - The keys of the properties to store, in sorted order.
+//                   This argument must not be nil.
+// capacity        - The number of models the array is expected to hold.
+// validatesModels - Whether -modelAtIndex:error: validates the models it
+//                   creates. This should be NO if only some properties are
+//                   stored.
+- (instancetype)initWithModelClass:(Class)modelClass propertyKeys:(NSArray *)propertyKeys capacity:(NSUInteger)capacity validatesModels:(BOOL)validatesModels;
+
+// Appends a model whose properties are all nil or zero.
+//
+// This must only be called while the receiver is being built, before it is
+// handed out.
+- (void)appendRow;
+
+// Sets the value of the property at `columnIndex` in `propertyKeys` of the
+// last appended model.
+//
+// value - The value to set. NSNull and nil are stored as nil, or zero if the
+//         property is stored as a C array.
+//
+// Returns NO if the property is stored as a C array but `value` is not an
+// NSNumber.
+- (BOOL)setValue:(id)value forColumnAtIndex:(NSUInteger)columnIndex;
+
+@end
@@ -0,0 +1,51 @@
+//
+//  MTLCompactStorage.h
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "MTLDefines.h"
+
+@class MTLModel;
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Backs the `@dynamic` properties of MTLModel subclasses which return YES from
+// +usesCompactStorage.
+//
+// Each instance stores its values in a single allocation, referenced from
+// MTLModel:
+//
+//  - Numbers and booleans are packed into as few bits as their types need.
+//    Where BOOL is a C99 bool (encoded as 'B'), eight BOOL properties take up
+//    a single byte; where it is a signed char (encoded as 'c'), each takes up
+//    eight bits like any other char.
+//  - Objects are only stored while they are not nil. A presence bitmap records
+//    which object properties have a value, and the values of those that do
+//    are kept in a dense array in property order.
+//
+// The layout of the storage is computed once per class, laying out the
+// properties of superclasses first, so that accessors installed on a
+// superclass work for instances of its subclasses too.
+//
+// -hash, -isEqual:, -copy and -dictionaryValue of MTLModel don't walk the
+// storage, but call the installed accessors through their IMPs like those of
+// any other property. Comparing or hashing raw bits would tell 0.0 from -0.0
+// and one NaN from another, which the accessors' boxed values do not.
+
+// Installs the accessors of all compactly stored properties of `modelClass`
+// and its superclasses, if that hasn't happened yet.
+//
+// Returns whether `selector` is one of those accessors.
+MANTLE_PRIVATE
+BOOL MTLCompactStorageResolveAccessor(Class modelClass, SEL selector);
+
+// Releases the values in `storage`, which was created for a model by a
+// compact storage accessor, and frees it.
+MANTLE_PRIVATE
+void MTLCompactStorageDestroy(void *storage);
+
+NS_ASSUME_NONNULL_END
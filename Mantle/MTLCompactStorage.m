@@ -0,0 +1,444 @@
+//
+//  MTLCompactStorage.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/EXTRuntimeExtensions.h>
+#import <Mantle/EXTScope.h>
+#import <objc/runtime.h>
+
+#import "MTLCompactStorage.h"
+#import "MTLModel.h"
+
+// Associated in MTLCompactStorageLayoutForClass() with the
+// MTLCompactStorageLayout of a class.
+static void *MTLCompactStorageLayoutKey = &MTLCompactStorageLayoutKey;
+
+// The offset of the `_compactStorage` instance variable of MTLModel, which is
+// looked up before the first accessor is installed.
+static ptrdiff_t MTLCompactStorageInstanceVariableOffset;
+
+// The values of the compactly stored properties of one model, which are
+// allocated the first time one of those properties is set.
+typedef struct {
+	// The number of 64-bit words holding numbers and booleans. These come
+	// first in `words`.
+	uint16_t scalarWordCount;
+
+	// The number of 64-bit words in the presence bitmap, which follows the
+	// scalar words.
+	uint16_t presenceWordCount;
+
+	// The number of objects which follow the presence bitmap, and the number
+	// of objects there is room for.
+	uint32_t objectCount;
+	uint32_t objectCapacity;
+
+	uint64_t words[];
+} MTLCompactStorage;
+
+// Describes where the compactly stored properties of a class are kept.
+@interface MTLCompactStorageLayout : NSObject
+
+// The number of object properties, including those of superclasses.
+@property (nonatomic, assign) NSUInteger objectSlotCount;
+
+// The number of bits used by number and boolean properties, including those of
+// superclasses.
+@property (nonatomic, assign) NSUInteger scalarBitCount;
+
+// The names of the selectors of all installed accessors, including those of
+// superclasses.
+@property (nonatomic, copy) NSSet *accessorNames;
+
+@end
+
+@implementation MTLCompactStorageLayout
+@end
+
+static inline MTLCompactStorage **MTLCompactStorageReference(__unsafe_unretained id model) {
+	return (MTLCompactStorage **)((uint8_t *)(__bridge void *)model + MTLCompactStorageInstanceVariableOffset);
+}
+
+static inline const uint64_t *MTLCompactStoragePresence(const MTLCompactStorage *storage) {
+	return storage->words + storage->scalarWordCount;
+}
+
+static inline void **MTLCompactStorageObjects(MTLCompactStorage *storage) {
+	return (void **)(storage->words + storage->scalarWordCount + storage->presenceWordCount);
+}
+
+static inline size_t MTLCompactStorageSize(NSUInteger wordCount, NSUInteger objectCapacity) {
+	return sizeof(MTLCompactStorage) + wordCount * sizeof(uint64_t) + objectCapacity * sizeof(void *);
+}
+
+// Returns the position of the object in slot `index` among the objects that
+// are present, which is the number of objects present in earlier slots.
+static inline NSUInteger MTLCompactStoragePosition(const MTLCompactStorage *storage, NSUInteger index) {
+	const uint64_t *presence = MTLCompactStoragePresence(storage);
+	NSUInteger position = 0;
+
+	for (NSUInteger i = 0; i < index / 64; i++) {
+		position += (NSUInteger)__builtin_popcountll(presence[i]);
+	}
+
+	return position + (NSUInteger)__builtin_popcountll(presence[index / 64] & ((1ULL << (index % 64)) - 1));
+}
+
+static MTLCompactStorageLayout *MTLCompactStorageLayoutForClass(Class modelClass);
+
+// Allocates the storage of `model`, with room for a few objects.
+static MTLCompactStorage *MTLCompactStorageCreate(__unsafe_unretained id model) {
+	MTLCompactStorageLayout *layout = MTLCompactStorageLayoutForClass([model class]);
+
+	NSUInteger scalarWordCount = (layout.scalarBitCount + 63) / 64;
+	NSUInteger presenceWordCount = (layout.objectSlotCount + 63) / 64;
+	NSUInteger objectCapacity = MIN(layout.objectSlotCount, (NSUInteger)4);
+
+	MTLCompactStorage *storage = calloc(1, MTLCompactStorageSize(scalarWordCount + presenceWordCount, objectCapacity));
+
+	// Accessors have no way to report errors, so fail like Foundation does.
+	if (storage == NULL) [NSException raise:NSMallocException format:@"Could not allocate the compact storage of %@", [model class]];
+
+	storage->scalarWordCount = (uint16_t)scalarWordCount;
+	storage->presenceWordCount = (uint16_t)presenceWordCount;
+	storage->objectCapacity = (uint32_t)objectCapacity;
+
+	*MTLCompactStorageReference(model) = storage;
+	return storage;
+}
+
+static id MTLCompactStorageGetObject(__unsafe_unretained id model, NSUInteger index) {
+	MTLCompactStorage *storage = *MTLCompactStorageReference(model);
+	if (storage == NULL) return nil;
+
+	if ((MTLCompactStoragePresence(storage)[index / 64] & (1ULL << (index % 64))) == 0) return nil;
+
+	return (__bridge id)MTLCompactStorageObjects(storage)[MTLCompactStoragePosition(storage, index)];
+}
+
+static void MTLCompactStorageSetObject(__unsafe_unretained id model, NSUInteger index, id value) {
+	MTLCompactStorage **reference = MTLCompactStorageReference(model);
+	MTLCompactStorage *storage = *reference;
+
+	if (storage == NULL) {
+		if (value == nil) return;
+
+		storage = MTLCompactStorageCreate(model);
+	}
+
+	uint64_t bit = 1ULL << (index % 64);
+	uint64_t *presenceWord = storage->words + storage->scalarWordCount + index / 64;
+	NSUInteger position = MTLCompactStoragePosition(storage, index);
+
+	if ((*presenceWord & bit) != 0) {
+		void **objects = MTLCompactStorageObjects(storage);
+		void *oldValue = objects[position];
+
+		if (value != nil) {
+			objects[position] = (void *)CFBridgingRetain(value);
+		} else {
+			memmove(objects + position, objects + position + 1, (storage->objectCount - position - 1) * sizeof(*objects));
+			storage->objectCount--;
+			*presenceWord &= ~bit;
+		}
+
+		// Release the old value last, in case its deallocation calls back into
+		// the model.
+		CFRelease(oldValue);
+		return;
+	}
+
+	if (value == nil) return;
+
+	if (storage->objectCount == storage->objectCapacity) {
+		NSUInteger wordCount = storage->scalarWordCount + storage->presenceWordCount;
+		uint32_t objectCapacity = MAX(storage->objectCapacity * 2, 4);
+
+		// The old storage stays valid if this fails.
+		MTLCompactStorage *grownStorage = realloc(storage, MTLCompactStorageSize(wordCount, objectCapacity));
+		if (grownStorage == NULL) [NSException raise:NSMallocException format:@"Could not grow the compact storage of %@", [model class]];
+
+		storage = grownStorage;
+		storage->objectCapacity = objectCapacity;
+		*reference = storage;
+
+		presenceWord = storage->words + storage->scalarWordCount + index / 64;
+	}
+
+	void **objects = MTLCompactStorageObjects(storage);
+	memmove(objects + position + 1, objects + position, (storage->objectCount - position) * sizeof(*objects));
+	objects[position] = (void *)CFBridgingRetain(value);
+
+	storage->objectCount++;
+	*presenceWord |= bit;
+}
+
+static inline uint64_t MTLCompactStorageGetBits(__unsafe_unretained id model, NSUInteger offset, NSUInteger width) {
+	const MTLCompactStorage *storage = *MTLCompactStorageReference(model);
+	if (storage == NULL) return 0;
+
+	uint64_t bits = storage->words[offset / 64] >> (offset % 64);
+	return (width == 64 ? bits : bits & ((1ULL << width) - 1));
+}
+
+static inline void MTLCompactStorageSetBits(__unsafe_unretained id model, NSUInteger offset, NSUInteger width, uint64_t bits) {
+	MTLCompactStorage *storage = *MTLCompactStorageReference(model);
+
+	if (storage == NULL) {
+		if (bits == 0) return;
+
+		storage = MTLCompactStorageCreate(model);
+	}
+
+	uint64_t mask = (width == 64 ? UINT64_MAX : (1ULL << width) - 1) << (offset % 64);
+	uint64_t *word = storage->words + offset / 64;
+
+	*word = (*word & ~mask) | ((bits << (offset % 64)) & mask);
+}
+
+// Returns the number of bits needed to store a property with the given type
+// encoding character, or 0 if the type is not a number or boolean.
+static NSUInteger MTLCompactStorageScalarWidth(char type) {
+	switch (type) {
+		case 'B': return 1;
+		case 'c': case 'C': return 8;
+		case 's': case 'S': return 16;
+		case 'i': case 'I': case 'f': return 32;
+		case 'l': case 'L': return sizeof(long) * 8;
+		case 'q': case 'Q': case 'd': return 64;
+		default: return 0;
+	}
+}
+
+// Adds a getter and setter for the property described by `attributes` to
+// `modelClass`, storing its value in object slot `index`.
+static void MTLCompactStorageAddObjectAccessors(Class modelClass, mtl_propertyAttributes *attributes, NSUInteger index) {
+	BOOL copy = attributes->memoryManagementPolicy == mtl_propertyMemoryManagementPolicyCopy;
+
+	id getter = ^ id (__unsafe_unretained id model) {
+		return MTLCompactStorageGetObject(model, index);
+	};
+
+	id setter = ^(__unsafe_unretained id model, id value) {
+		MTLCompactStorageSetObject(model, index, (copy ? [value copy] : value));
+	};
+
+	class_addMethod(modelClass, attributes->getter, imp_implementationWithBlock(getter), "@@:");
+	class_addMethod(modelClass, attributes->setter, imp_implementationWithBlock(setter), "v@:@");
+}
+
+// Adds a getter and setter for the property described by `attributes` to
+// `modelClass`, storing its value in `width` bits starting at bit `offset`.
+static void MTLCompactStorageAddScalarAccessors(Class modelClass, mtl_propertyAttributes *attributes, char type, NSUInteger offset, NSUInteger width) {
+	id getter = nil;
+	id setter = nil;
+
+#define MTLCompactStorageIntegerAccessors(TYPE) \
+	getter = ^ TYPE (__unsafe_unretained id model) { \
+		return (TYPE)MTLCompactStorageGetBits(model, offset, width); \
+	}; \
+	setter = ^(__unsafe_unretained id model, TYPE value) { \
+		MTLCompactStorageSetBits(model, offset, width, (uint64_t)value); \
+	}
+
+	switch (type) {
+		case 'B': MTLCompactStorageIntegerAccessors(bool); break;
+		case 'c': MTLCompactStorageIntegerAccessors(char); break;
+		case 'C': MTLCompactStorageIntegerAccessors(unsigned char); break;
+		case 's': MTLCompactStorageIntegerAccessors(short); break;
+		case 'S': MTLCompactStorageIntegerAccessors(unsigned short); break;
+		case 'i': MTLCompactStorageIntegerAccessors(int); break;
+		case 'I': MTLCompactStorageIntegerAccessors(unsigned int); break;
+		case 'l': MTLCompactStorageIntegerAccessors(long); break;
+		case 'L': MTLCompactStorageIntegerAccessors(unsigned long); break;
+		case 'q': MTLCompactStorageIntegerAccessors(long long); break;
+		case 'Q': MTLCompactStorageIntegerAccessors(unsigned long long); break;
+
+		case 'f':
+			getter = ^ float (__unsafe_unretained id model) {
+				uint32_t bits = (uint32_t)MTLCompactStorageGetBits(model, offset, width);
+				float value;
+				memcpy(&value, &bits, sizeof(value));
+				return value;
+			};
+
+			setter = ^(__unsafe_unretained id model, float value) {
+				uint32_t bits;
+				memcpy(&bits, &value, sizeof(bits));
+				MTLCompactStorageSetBits(model, offset, width, bits);
+			};
+
+			break;
+
+		case 'd':
+			getter = ^ double (__unsafe_unretained id model) {
+				uint64_t bits = MTLCompactStorageGetBits(model, offset, width);
+				double value;
+				memcpy(&value, &bits, sizeof(value));
+				return value;
+			};
+
+			setter = ^(__unsafe_unretained id model, double value) {
+				uint64_t bits;
+				memcpy(&bits, &value, sizeof(bits));
+				MTLCompactStorageSetBits(model, offset, width, bits);
+			};
+
+			break;
+	}
+
+#undef MTLCompactStorageIntegerAccessors
+
+	char getterTypes[] = { type, '@', ':', '\0' };
+	char setterTypes[] = { 'v', '@', ':', type, '\0' };
+
+	class_addMethod(modelClass, attributes->getter, imp_implementationWithBlock(getter), getterTypes);
+	class_addMethod(modelClass, attributes->setter, imp_implementationWithBlock(setter), setterTypes);
+}
+
+// Lays out the properties declared by `modelClass` after those of its
+// superclass, and installs their accessors.
+static MTLCompactStorageLayout *MTLCompactStorageCreateLayout(Class modelClass) {
+	Class superclass = class_getSuperclass(modelClass);
+	MTLCompactStorageLayout *superclassLayout = nil;
+
+	if (superclass != MTLModel.class && [superclass usesCompactStorage]) {
+		superclassLayout = MTLCompactStorageLayoutForClass(superclass);
+	}
+
+	NSUInteger objectSlotCount = superclassLayout.objectSlotCount;
+	NSUInteger scalarBitCount = superclassLayout.scalarBitCount;
+	NSMutableSet *accessorNames = [NSMutableSet setWithSet:superclassLayout.accessorNames ?: [NSSet set]];
+
+	// Leave properties alone whose accessors the class implements itself.
+	unsigned methodCount = 0;
+	Method *methods = class_copyMethodList(modelClass, &methodCount);
+	NSMutableSet *implementedNames = [NSMutableSet setWithCapacity:methodCount];
+
+	for (unsigned i = 0; i < methodCount; i++) {
+		[implementedNames addObject:NSStringFromSelector(method_getName(methods[i]))];
+	}
+
+	free(methods);
+
+	unsigned propertyCount = 0;
+	objc_property_t *properties = class_copyPropertyList(modelClass, &propertyCount);
+	NSMutableArray *scalarProperties = [NSMutableArray array];
+
+	@onExit {
+		free(properties);
+	};
+
+	for (unsigned i = 0; i < propertyCount; i++) {
+		mtl_propertyAttributes *attributes = mtl_copyPropertyAttributes(properties[i]);
+		if (attributes == NULL) continue;
+
+		@onExit {
+			free(attributes);
+		};
+
+		if (!attributes->dynamic || attributes->readonly) continue;
+
+		NSString *getterName = NSStringFromSelector(attributes->getter);
+		NSString *setterName = NSStringFromSelector(attributes->setter);
+
+		if ([implementedNames containsObject:getterName] || [implementedNames containsObject:setterName]) continue;
+
+		// Redeclared properties are already stored for the superclass.
+		if ([accessorNames containsObject:getterName]) continue;
+
+		const char *type = attributes->type;
+		while (*type != '\0' && strchr("rnNoORV", *type) != NULL) type++;
+
+		if (*type == '@') {
+			if (attributes->weak || attributes->memoryManagementPolicy == mtl_propertyMemoryManagementPolicyAssign) {
+				[NSException raise:NSInvalidArgumentException format:@"Cannot store \"%s\" of %@ compactly, because it is not a strong or copied property", property_getName(properties[i]), modelClass];
+			}
+
+			MTLCompactStorageAddObjectAccessors(modelClass, attributes, objectSlotCount++);
+		} else {
+			NSUInteger width = MTLCompactStorageScalarWidth(*type);
+
+			if (width == 0) {
+				[NSException raise:NSInvalidArgumentException format:@"Cannot store \"%s\" of %@ compactly, because its type \"%s\" is not an object, number or boolean", property_getName(properties[i]), modelClass, attributes->type];
+			}
+
+			[scalarProperties addObject:@{
+				@"index": @(i),
+				@"width": @(width),
+			}];
+		}
+
+		[accessorNames addObject:getterName];
+		[accessorNames addObject:setterName];
+	}
+
+	// Pack numbers and booleans from widest to narrowest, which keeps every
+	// value aligned to its own width, so none straddles two words.
+	[scalarProperties sortUsingComparator:^(NSDictionary *first, NSDictionary *second) {
+		return [second[@"width"] compare:first[@"width"]];
+	}];
+
+	for (NSDictionary *scalarProperty in scalarProperties) {
+		NSUInteger width = [scalarProperty[@"width"] unsignedIntegerValue];
+		NSUInteger offset = (scalarBitCount + width - 1) / width * width;
+
+		mtl_propertyAttributes *attributes = mtl_copyPropertyAttributes(properties[[scalarProperty[@"index"] unsignedIntegerValue]]);
+
+		const char *type = attributes->type;
+		while (*type != '\0' && strchr("rnNoORV", *type) != NULL) type++;
+
+		MTLCompactStorageAddScalarAccessors(modelClass, attributes, *type, offset, width);
+		free(attributes);
+
+		scalarBitCount = offset + width;
+	}
+
+	MTLCompactStorageLayout *layout = [[MTLCompactStorageLayout alloc] init];
+	layout.objectSlotCount = objectSlotCount;
+	layout.scalarBitCount = scalarBitCount;
+	layout.accessorNames = accessorNames;
+
+	return layout;
+}
+
+static MTLCompactStorageLayout *MTLCompactStorageLayoutForClass(Class modelClass) {
+	MTLCompactStorageLayout *layout = objc_getAssociatedObject(modelClass, MTLCompactStorageLayoutKey);
+	if (layout != nil) return layout;
+
+	// Serialize layouts, since classes get accessors added along the way.
+	@synchronized (MTLCompactStorageLayout.class) {
+		layout = objc_getAssociatedObject(modelClass, MTLCompactStorageLayoutKey);
+		if (layout != nil) return layout;
+
+		if (MTLCompactStorageInstanceVariableOffset == 0) {
+			MTLCompactStorageInstanceVariableOffset = ivar_getOffset(class_getInstanceVariable(MTLModel.class, "_compactStorage"));
+		}
+
+		layout = MTLCompactStorageCreateLayout(modelClass);
+		objc_setAssociatedObject(modelClass, MTLCompactStorageLayoutKey, layout, OBJC_ASSOCIATION_RETAIN);
+	}
+
+	return layout;
+}
+
+BOOL MTLCompactStorageResolveAccessor(Class modelClass, SEL selector) {
+	if (modelClass == MTLModel.class) return NO;
+
+	return [MTLCompactStorageLayoutForClass(modelClass).accessorNames containsObject:NSStringFromSelector(selector)];
+}
+
+void MTLCompactStorageDestroy(void *storage) {
+	MTLCompactStorage *compactStorage = storage;
+	void **objects = MTLCompactStorageObjects(compactStorage);
+
+	for (uint32_t i = 0; i < compactStorage->objectCount; i++) {
+		CFRelease(objects[i]);
+	}
+
+	free(compactStorage);
+}
@@ -0,0 +1,88 @@
+//
+//  MTLIdentityMap.h
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@protocol MTLModel;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Keeps track of one model per primary key, so that decoding the same entity
+/// again updates the model decoded before instead of creating another one.
+///
+/// An MTLJSONAdapter whose `identityMap` is set passes every model of a class
+/// implementing +[MTLJSONSerializing primaryKeyPropertyKey] through
+/// -upsertModel:forPrimaryKey:. This includes nested models decoded by the
+/// transformers from +dictionaryTransformerWithModelClass: and all transformers
+/// built on top of it.
+///
+/// Models are tracked per class, and only referenced weakly, so that a model
+/// disappears from the map once nothing else uses it. A map created with
+/// -initWithCountLimit: additionally keeps up to about `countLimit` recently
+/// upserted models alive by itself.
+///
+/// Lookups are spread over independently locked shards, so that maps can be
+/// used from multiple threads at once. Upserts of the same primary key merge
+/// one after the other, but reading a model while another thread merges into
+/// it is not safe.
+@interface MTLIdentityMap : NSObject
+
+/// Initializes a map which only references its models weakly.
+- (instancetype)init;
+
+/// Initializes a map which keeps up to about `countLimit` of its most recently
+/// upserted models alive.
+///
+/// countLimit - The number of models to keep alive. If zero, models are only
+///              referenced weakly.
+- (instancetype)initWithCountLimit:(NSUInteger)countLimit NS_DESIGNATED_INITIALIZER;
+
+/// The number of models the receiver keeps alive by itself, or zero if it only
+/// references its models weakly.
+@property (nonatomic, assign, readonly) NSUInteger countLimit;
+
+/// Returns the model of class `modelClass` with the given primary key, or nil
+/// if there is none.
+- (nullable id)modelOfClass:(Class)modelClass forPrimaryKey:(id)primaryKey;
+
+/// Returns the model that represents the same entity as `model` from now on.
+///
+/// If the receiver has no model of the class of `model` with the same primary
+/// key yet, `model` is added to the receiver and returned. Otherwise, the
+/// non-nil values of `model` are merged into the existing model using
+/// -mergeValueForKey:fromModel:, and the existing model is returned. Nil values
+/// are skipped, since they usually stand for keys missing from a partial
+/// payload rather than for values to clear.
+///
+/// Since immutable models (see +[MTLModel isImmutable]) cannot be updated, an
+/// existing immutable model is only returned if it is equal to `model`.
+/// Otherwise, `model` takes its place.
+///
+/// model      - The model to add or merge. This argument must not be nil.
+/// primaryKey - The primary key of `model`. This argument must not be nil.
+- (id)upsertModel:(id<MTLModel>)model forPrimaryKey:(id)primaryKey;
+
+/// Like -upsertModel:forPrimaryKey:, but only merges the values of the given
+/// properties, like those decoded with a field mask.
+///
+/// An existing immutable model is returned unless one of the non-nil values of
+/// the given properties differs. Otherwise, since `model` is incomplete, a new
+/// model with the values of the existing one, overridden by the non-nil values
+/// of the given properties of `model`, takes its place and is returned. If the
+/// new model fails validation, the existing model is kept.
+///
+/// propertyKeys - The keys of the properties to merge, or nil to merge all
+///                properties.
+- (id)upsertModel:(id<MTLModel>)model forPrimaryKey:(id)primaryKey propertyKeys:(nullable NSSet<NSString *> *)propertyKeys;
+
+/// Forgets all models.
+- (void)removeAllModels;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,234 @@
+//
+//  MTLIdentityMap.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <pthread.h>
+
+#import <Mantle/EXTScope.h>
+
+#import "MTLIdentityMap.h"
+#import "MTLModel.h"
+
+// The number of independently locked shards each map is split into, so that
+// concurrent lookups of different primary keys rarely contend.
+static const NSUInteger MTLIdentityMapShardCount = 8;
+
+// A part of an identity map protected by its own lock.
+@interface MTLIdentityMapShard : NSObject {
+	pthread_mutex_t _lock;
+}
+
+// Map tables from primary keys to weakly referenced models, keyed by model
+// class. Only accessed while holding the lock.
+@property (nonatomic, strong, readonly) NSMutableDictionary *modelsByClass;
+
+// Returns the model of `modelClass` for `primaryKey`, or nil if there is none.
+- (id)modelOfClass:(Class)modelClass forPrimaryKey:(id)primaryKey;
+
+// Adds `model` for `primaryKey` if there is no model of its class for that key
+// yet, and returns it. Otherwise, invokes `block` with the existing model, and
+// replaces it with the model the block returns.
+//
+// The block is invoked while holding the lock, so that upserts of the same
+// primary key don't interleave. It may upsert models itself.
+- (id)upsertModel:(id)model forPrimaryKey:(id)primaryKey usingBlock:(id (^)(id existingModel))block;
+
+- (void)removeAllModels;
+
+@end
+
+@interface MTLIdentityMap ()
+
+@property (nonatomic, copy, readonly) NSArray *shards;
+
+// Keeps recently upserted models alive, or nil if the receiver only references
+// its models weakly.
+@property (nonatomic, strong, readonly) NSCache *retainedModels;
+
+@end
+
+// Returns `existingModel` if the non-nil values of `propertyKeys` on the
+// partially decoded `model` equal its own. Otherwise, returns a new model with
+// the values of `existingModel`, overridden by those non-nil values, unless it
+// fails validation, in which case `existingModel` is returned as well.
+static id MTLIdentityMapMergedImmutableModel(MTLModel *existingModel, MTLModel *model, NSSet *propertyKeys) {
+	NSMutableDictionary *changedValues = nil;
+
+	for (NSString *key in propertyKeys) {
+		id value = [model valueForKey:key];
+		if (value == nil || [value isEqual:[existingModel valueForKey:key]]) continue;
+
+		if (changedValues == nil) changedValues = [NSMutableDictionary dictionary];
+		changedValues[key] = value;
+	}
+
+	if (changedValues == nil) return existingModel;
+
+	NSMutableDictionary *values = [existingModel.dictionaryValue mutableCopy];
+	[values addEntriesFromDictionary:changedValues];
+
+	return [existingModel.class modelWithDictionary:values error:NULL] ?: existingModel;
+}
+
+@implementation MTLIdentityMap
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	return [self initWithCountLimit:0];
+}
+
+- (instancetype)initWithCountLimit:(NSUInteger)countLimit {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_countLimit = countLimit;
+
+	NSMutableArray *shards = [NSMutableArray arrayWithCapacity:MTLIdentityMapShardCount];
+	for (NSUInteger i = 0; i < MTLIdentityMapShardCount; i++) {
+		[shards addObject:[[MTLIdentityMapShard alloc] init]];
+	}
+
+	_shards = [shards copy];
+
+	if (countLimit > 0) {
+		_retainedModels = [[NSCache alloc] init];
+		_retainedModels.countLimit = countLimit;
+	}
+
+	return self;
+}
+
+#pragma mark Models
+
+- (MTLIdentityMapShard *)shardForPrimaryKey:(id)primaryKey {
+	return self.shards[[primaryKey hash] % self.shards.count];
+}
+
+- (id)modelOfClass:(Class)modelClass forPrimaryKey:(id)primaryKey {
+	NSParameterAssert(modelClass != nil);
+	NSParameterAssert(primaryKey != nil);
+
+	return [[self shardForPrimaryKey:primaryKey] modelOfClass:modelClass forPrimaryKey:primaryKey];
+}
+
+- (id)upsertModel:(id<MTLModel>)model forPrimaryKey:(id)primaryKey {
+	return [self upsertModel:model forPrimaryKey:primaryKey propertyKeys:nil];
+}
+
+- (id)upsertModel:(id<MTLModel>)model forPrimaryKey:(id)primaryKey propertyKeys:(NSSet *)propertyKeys {
+	NSParameterAssert(model != nil);
+	NSParameterAssert(primaryKey != nil);
+
+	id upsertedModel = [[self shardForPrimaryKey:primaryKey] upsertModel:model forPrimaryKey:primaryKey usingBlock:^ id (id existingModel) {
+		if (existingModel == model) return existingModel;
+
+		if ([model isKindOfClass:MTLModel.class] && [model.class isImmutable]) {
+			if (propertyKeys == nil) return ([existingModel isEqual:model] ? existingModel : model);
+
+			return MTLIdentityMapMergedImmutableModel(existingModel, (MTLModel *)model, propertyKeys);
+		}
+
+		// Nil values are most likely missing from the JSON the model was decoded
+		// from, so they must not clear what is known already.
+		for (NSString *key in propertyKeys ?: [model.class propertyKeys]) {
+			if ([(NSObject *)model valueForKey:key] == nil) continue;
+
+			[existingModel mergeValueForKey:key fromModel:model];
+		}
+
+		return existingModel;
+	}];
+
+	[self.retainedModels setObject:upsertedModel forKey:[NSValue valueWithNonretainedObject:upsertedModel]];
+
+	return upsertedModel;
+}
+
+- (void)removeAllModels {
+	for (MTLIdentityMapShard *shard in self.shards) {
+		[shard removeAllModels];
+	}
+
+	[self.retainedModels removeAllObjects];
+}
+
+@end
+
+@implementation MTLIdentityMapShard
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_modelsByClass = [[NSMutableDictionary alloc] init];
+
+	// Merging may upsert nested models, which can belong to the same shard.
+	pthread_mutexattr_t attributes;
+	pthread_mutexattr_init(&attributes);
+	pthread_mutexattr_settype(&attributes, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(&_lock, &attributes);
+	pthread_mutexattr_destroy(&attributes);
+
+	return self;
+}
+
+- (void)dealloc {
+	pthread_mutex_destroy(&_lock);
+}
+
+#pragma mark Models
+
+// Must be called while holding the lock.
+- (NSMapTable *)modelsOfClass:(Class)modelClass {
+	NSMapTable *models = self.modelsByClass[modelClass];
+
+	if (models == nil) {
+		models = [NSMapTable strongToWeakObjectsMapTable];
+		self.modelsByClass[(id<NSCopying>)modelClass] = models;
+	}
+
+	return models;
+}
+
+- (id)modelOfClass:(Class)modelClass forPrimaryKey:(id)primaryKey {
+	pthread_mutex_lock(&_lock);
+	id model = [self.modelsByClass[modelClass] objectForKey:primaryKey];
+	pthread_mutex_unlock(&_lock);
+
+	return model;
+}
+
+- (id)upsertModel:(id)model forPrimaryKey:(id)primaryKey usingBlock:(id (^)(id existingModel))block {
+	pthread_mutex_lock(&_lock);
+	@onExit {
+		pthread_mutex_unlock(&_lock);
+	};
+
+	NSMapTable *models = [self modelsOfClass:[model class]];
+	id existingModel = [models objectForKey:primaryKey];
+
+	if (existingModel == nil) {
+		[models setObject:model forKey:primaryKey];
+		return model;
+	}
+
+	id upsertedModel = block(existingModel);
+	if (upsertedModel != existingModel) [models setObject:upsertedModel forKey:primaryKey];
+
+	return upsertedModel;
+}
+
+- (void)removeAllModels {
+	pthread_mutex_lock(&_lock);
+	[self.modelsByClass removeAllObjects];
+	pthread_mutex_unlock(&_lock);
+}
+
+@end
@@ -0,0 +1,57 @@
+//
+//  MTLInterningContext.h
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Shares a single instance between equal immutable models.
+///
+/// JSON often repeats the same sub-object many times, like the owner of every
+/// item in a list. Decoding it with an MTLJSONAdapter whose `interningContext`
+/// is set replaces every model equal to one decoded earlier in the same context
+/// with that earlier instance. This includes nested models decoded by the
+/// transformers from +dictionaryTransformerWithModelClass: and all transformers
+/// built on top of it. Since nested models are interned before the models
+/// containing them, equal parents are recognized by comparing their shared
+/// children by identity.
+///
+/// Only instances of MTLModel subclasses for which +isImmutable returns YES are
+/// interned. Sharing mutable models would make changes to one occurrence show
+/// up in all of them.
+///
+/// A context keeps every model it interns alive for as long as the context
+/// itself, so contexts are best scoped to a decoding session, like a single
+/// response or a cache load. Contexts may be used from multiple threads at
+/// once.
+@interface MTLInterningContext : NSObject
+
+/// Returns the instance equal to `model` that the receiver interned first.
+///
+/// If no equal model has been interned yet, `model` is interned and returned.
+/// Any object other than an immutable MTLModel is returned as is.
+- (id)internModel:(id)model;
+
+/// The number of distinct models the receiver holds on to.
+@property (atomic, assign, readonly) NSUInteger modelCount;
+
+/// The number of models that were replaced by an equal, previously interned
+/// model.
+@property (atomic, assign, readonly) NSUInteger internedModelCount;
+
+/// The number of bytes allocated for the models that were replaced by an
+/// equal, previously interned model.
+///
+/// This only counts the model objects themselves. Their property values are
+/// released along with them, unless they are shared with other objects, which
+/// is always the case for nested models that were interned too.
+@property (atomic, assign, readonly) NSUInteger savedByteCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
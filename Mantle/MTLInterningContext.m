@@ -0,0 +1,97 @@
+//
+//  MTLInterningContext.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <malloc/malloc.h>
+#import <pthread.h>
+
+#import "MTLInterningContext.h"
+#import "MTLModel.h"
+
+@implementation MTLInterningContext {
+	pthread_mutex_t _lock;
+
+	// Only accessed while holding the lock.
+	NSMutableSet *_models;
+	NSUInteger _internedModelCount;
+	NSUInteger _savedByteCount;
+}
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_models = [[NSMutableSet alloc] init];
+	pthread_mutex_init(&_lock, NULL);
+
+	return self;
+}
+
+- (void)dealloc {
+	pthread_mutex_destroy(&_lock);
+}
+
+#pragma mark Interning
+
+- (id)internModel:(id)model {
+	if (![model isKindOfClass:MTLModel.class] || ![[model class] isImmutable]) return model;
+
+	// Immutable models cache their hash, so compute it outside of the lock.
+	[model hash];
+
+	pthread_mutex_lock(&_lock);
+
+	id internedModel = [_models member:model];
+
+	if (internedModel == nil) {
+		[_models addObject:model];
+		internedModel = model;
+	} else if (internedModel != model) {
+		_internedModelCount++;
+		_savedByteCount += malloc_size((__bridge const void *)model);
+	}
+
+	pthread_mutex_unlock(&_lock);
+
+	return internedModel;
+}
+
+#pragma mark Statistics
+
+- (NSUInteger)modelCount {
+	pthread_mutex_lock(&_lock);
+	NSUInteger modelCount = _models.count;
+	pthread_mutex_unlock(&_lock);
+
+	return modelCount;
+}
+
+- (NSUInteger)internedModelCount {
+	pthread_mutex_lock(&_lock);
+	NSUInteger internedModelCount = _internedModelCount;
+	pthread_mutex_unlock(&_lock);
+
+	return internedModelCount;
+}
+
+- (NSUInteger)savedByteCount {
+	pthread_mutex_lock(&_lock);
+	NSUInteger savedByteCount = _savedByteCount;
+	pthread_mutex_unlock(&_lock);
+
+	return savedByteCount;
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> models: %lu, interned: %lu, saved bytes: %lu", self.class, self, (unsigned long)self.modelCount, (unsigned long)self.internedModelCount, (unsigned long)self.savedByteCount];
+}
+
+@end
@@ -9,11 +9,39 @@
 #import <Foundation/Foundation.h>
 #import "MTLDefines.h"
 
+@class MTLColumnarModelArray<__covariant Model>;
+@class MTLIdentityMap;
+@class MTLInterningContext;
+@class MTLJSONDecodingLimits;
 @protocol MTLModel;
 @protocol MTLTransformerErrorHandling;
 
 NS_ASSUME_NONNULL_BEGIN
 
+/// Describes which values of a property MTLJSONAdapter leaves out of the JSON
+/// dictionaries it serializes.
+///
+/// MTLJSONOmissionPolicyNone         - All values are serialized.
+/// MTLJSONOmissionPolicyNil          - The property is left out if it is nil.
+///                                     Its transformer is not invoked.
+/// MTLJSONOmissionPolicyNull         - The property is left out if its
+///                                     transformer produces NSNull, or if it is
+///                                     nil and it has no reversible
+///                                     transformer.
+/// MTLJSONOmissionPolicyDefaultValue - The property is left out if it is equal
+///                                     to its value in
+///                                     +JSONDefaultValuesByPropertyKey. Its
+///                                     transformer is not invoked.
+///
+/// The JSON objects along the key path of a property are created even if the
+/// property itself is left out.
+typedef NS_OPTIONS(NSUInteger, MTLJSONOmissionPolicy) {
+	MTLJSONOmissionPolicyNone = 0,
+	MTLJSONOmissionPolicyNil = 1 << 0,
+	MTLJSONOmissionPolicyNull = 1 << 1,
+	MTLJSONOmissionPolicyDefaultValue = 1 << 2,
+};
+
 /// A MTLModel object that supports being parsed from and serialized to JSON.
 @protocol MTLJSONSerializing <MTLModel>
 @required
@@ -78,6 +106,48 @@ NS_ASSUME_NONNULL_BEGIN
 /// to abort parsing (e.g., if the data is invalid).
 + (nullable Class)classForParsingJSONDictionary:(NSDictionary<NSString *, id> *)JSONDictionary;
 
+/// Specifies the property whose value uniquely identifies instances of the
+/// receiver, like a database ID.
+///
+/// MTLJSONAdapters with an `identityMap` use the value of this property to
+/// find the model that was decoded for the same entity before, and update it
+/// rather than returning a new model. Models for which the property is nil are
+/// always returned as they are.
+///
+/// Returns the key of a property of the receiver.
++ (NSString *)primaryKeyPropertyKey;
+
+/// Specifies which values MTLJSONAdapter leaves out when serializing any
+/// property of the receiver which +JSONOmissionPoliciesByPropertyKey doesn't
+/// mention.
+///
+/// If this method is not implemented, all values are serialized.
++ (MTLJSONOmissionPolicy)JSONOmissionPolicy;
+
+/// Specifies which values MTLJSONAdapter leaves out when serializing specific
+/// properties of the receiver, overriding +JSONOmissionPolicy.
+///
+/// Subclasses overriding this method should combine their values with those of
+/// `super`.
+///
+/// Returns a dictionary mapping property keys to MTLJSONOmissionPolicy values
+/// wrapped in NSNumbers.
++ (NSDictionary<NSString *, NSNumber *> *)JSONOmissionPoliciesByPropertyKey;
+
+/// Specifies the default values of properties of the receiver, which
+/// MTLJSONAdapter leaves out when serializing properties whose omission policy
+/// includes MTLJSONOmissionPolicyDefaultValue.
+///
+/// Values are compared with the property values before transforming them, so
+/// they must be given as property values rather than JSON, with numbers and
+/// BOOLs wrapped in NSNumbers.
+///
+/// Subclasses overriding this method should combine their values with those of
+/// `super`.
+///
+/// Returns a dictionary mapping property keys to default values.
++ (NSDictionary<NSString *, id> *)JSONDefaultValuesByPropertyKey;
+
 @end
 
 /// The domain for errors originating from MTLJSONAdapter.
@@ -96,9 +166,23 @@ extern const NSInteger MTLJSONAdapterErrorInvalidJSONMapping;
 /// An exception was thrown and caught.
 extern const NSInteger MTLJSONAdapterErrorExceptionThrown;
 
+/// A serialized value could not be encoded as canonical JSON.
+extern const NSInteger MTLJSONAdapterErrorInvalidJSONValue;
+
+/// A `$ref` in the provided JSON did not match the `$id` of any model decoded
+/// before it, or referred to a model of the wrong class.
+extern const NSInteger MTLJSONAdapterErrorUnresolvedReference;
+
+/// The provided JSON exceeded one of the `limits` of the adapter.
+extern const NSInteger MTLJSONAdapterErrorLimitExceeded;
+
 /// Associated with the NSException that was caught.
 extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 
+/// Associated with the name of the MTLJSONDecodingLimits property which was
+/// exceeded, like `maximumDepth`.
+extern NSString * const MTLJSONAdapterExceededLimitErrorKey;
+
 /// Converts a MTLModel object to and from a JSON dictionary.
 @interface MTLJSONAdapter<__covariant Model: id<MTLJSONSerializing>> : NSObject
 
@@ -134,6 +218,30 @@ extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 /// error occurred.
 + (nullable NSArray<__kindof Model> *)modelsOfClass:(Class)modelClass fromJSONArray:(NSArray<NSDictionary<NSString *, id> *> *)JSONArray error:(NSError **)error;
 
+/// Attempts to parse only the JSON dictionaries of an array matching a
+/// predicate into model objects of a specific class.
+///
+/// The predicate is evaluated on the raw JSON of each element, before any
+/// transformer runs or any model is allocated, so elements which don't match
+/// are never decoded at all. Its key paths are JSON key paths, which are
+/// resolved the same way as those of +JSONKeyPathsByPropertyKey: a key path
+/// leading through a value which is not a JSON object evaluates to nil instead
+/// of raising an exception, and JSON null compares equal to nil.
+///
+/// modelClass - The MTLModel subclass to attempt to parse from the JSON. This
+///              class must conform to <MTLJSONSerializing>. This argument must
+///              not be nil.
+/// JSONArray  - A array of dictionaries representing JSON data. If this
+///              argument is nil, the method returns nil.
+/// predicate  - The predicate an element must match to be decoded, like
+///              `state == "open"`. If nil, all elements are decoded.
+/// error      - If not NULL, this may be set to an error that occurs during
+///              parsing or initializing any of the instances of `modelClass`.
+///
+/// Returns an array of `modelClass` instances for the matching elements upon
+/// success, or nil if a parsing error occurred.
++ (nullable NSArray<__kindof Model> *)modelsOfClass:(Class)modelClass fromJSONArray:(NSArray<NSDictionary<NSString *, id> *> *)JSONArray matchingPredicate:(nullable NSPredicate *)predicate error:(NSError **)error;
+
 /// Converts a model into a JSON representation.
 ///
 /// model - The model to use for JSON serialization. This argument must not be
@@ -144,6 +252,11 @@ extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 /// Returns a JSON dictionary, or nil if a serialization error occurred.
 + (nullable NSDictionary<NSString *, id> *)JSONDictionaryFromModel:(Model)model error:(NSError **)error;
 
+/// Converts a model into canonical JSON data.
+///
+/// See -canonicalJSONDataFromModel:error: for details.
++ (nullable NSData *)canonicalJSONDataFromModel:(Model)model error:(NSError **)error;
+
 /// Converts a array of models into a JSON representation.
 ///
 /// models - The array of models to use for JSON serialization. This argument
@@ -164,6 +277,137 @@ extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 /// Returns an initialized adapter.
 - (instancetype)initWithModelClass:(Class)modelClass;
 
+/// Shares instances between equal immutable models decoded by the receiver.
+///
+/// If not nil, every model decoded by -modelFromJSONDictionary:error: is
+/// passed through the context. While the receiver decodes a model, the context
+/// is also used by the adapters of nested transformers, like those returned by
+/// +dictionaryTransformerWithModelClass: and +arrayTransformerWithModelClass:,
+/// unless they have a context of their own.
+///
+/// This property is nil by default.
+@property (nonatomic, strong, nullable) MTLInterningContext *interningContext;
+
+/// Tracks models by their primary key across decodes.
+///
+/// If not nil, every model decoded by -modelFromJSONDictionary:error: whose
+/// class implements +primaryKeyPropertyKey is passed through
+/// -[MTLIdentityMap upsertModel:forPrimaryKey:], so that decoding an entity
+/// which has been decoded before updates and returns the existing model. While
+/// the receiver decodes a model, the map is also used by the adapters of nested
+/// transformers, unless they have a map of their own.
+///
+/// This property is nil by default.
+@property (nonatomic, strong, nullable) MTLIdentityMap *identityMap;
+
+/// Whether -JSONDictionaryFromModel:error: only serializes the properties
+/// which changed since the model was last checkpointed.
+///
+/// If YES, models are serialized according to -[MTLModel changedKeyPaths],
+/// after filtering their keys through -serializablePropertyKeys:forModel:.
+/// Properties which hold models that changed in place, and were created with
+/// +dictionaryTransformerWithModelClass:, are serialized as JSON objects
+/// containing only the changes of those models. Any other changed property is
+/// serialized in full. Objects which are not MTLModels are serialized in full,
+/// too.
+///
+/// Combined with +[MTLModel tracksChanges], this allows sending back only what
+/// changed since a model was decoded.
+///
+/// This property is NO by default.
+@property (nonatomic, assign) BOOL serializesChangesOnly;
+
+/// Whether models are serialized with references to models serialized before,
+/// and references are resolved when deserializing.
+///
+/// If YES, -JSONDictionaryFromModel:error: writes every model instance it
+/// encounters only once, adding a `$id` key with an identifier unique within
+/// the resulting dictionary. Every further occurrence of the same instance,
+/// including those in cycles, is written as a JSON object containing only a
+/// `$ref` key with that identifier. This keeps graphs with shared models small
+/// and makes graphs with cycles serializable at all.
+///
+/// -modelFromJSONDictionary:error: resolves such references to the very model
+/// decoded for the object with the same `$id`. To allow references back to a
+/// model which is still being decoded, models with a `$id` are initialized
+/// with -initWithDictionary:error: and a nil dictionary first, and their
+/// properties are validated and set one by one afterwards, as with
+/// -updateModel:withJSONDictionary:error:.
+///
+/// While the receiver serializes or deserializes a model, references are also
+/// written and resolved by the adapters of nested transformers. Immutable
+/// models are not memoized in this mode, since their JSON depends on the models
+/// serialized before them.
+///
+/// Models must not map any property to the JSON keys `$id` or `$ref`.
+///
+/// This property is NO by default.
+@property (nonatomic, assign) BOOL preservesReferences;
+
+/// The number of elements from which the JSON arrays of properties are decoded
+/// concurrently.
+///
+/// If not zero, -modelFromJSONDictionary:error: transforms every property whose
+/// JSON value is an array of at least this many elements as a separate work
+/// item, after the other properties have been decoded. The work items are
+/// applied concurrently on a global dispatch queue, with the calling thread
+/// performing some of them, so a single such property is decoded on the
+/// calling thread. The method returns the same model as when decoding serially.
+/// If several properties fail, the error of the first one in order of their
+/// property keys is reported, and exceptions are handled as if they had been
+/// thrown on the calling thread.
+///
+/// The transformers of such properties must be safe to call from multiple
+/// threads, as the ones created by +arrayTransformerWithModelClass: are. While
+/// the receiver decodes a model, the threshold is also used by the adapters of
+/// nested transformers, unless they have one of their own. Arrays within the
+/// elements of an array decoded concurrently are decoded on the thread of its
+/// work item, though. Nothing is decoded concurrently while references are
+/// preserved or an identity map is used, since references have to be resolved
+/// and models with the same primary key merged in document order.
+///
+/// This property is 0 by default.
+@property (nonatomic, assign) NSUInteger parallelArrayThreshold;
+
+/// Whether nested models are decoded with an explicit stack instead of by
+/// recursion.
+///
+/// If YES, -modelFromJSONDictionary:error: decodes the nested models of
+/// properties whose transformers were created by
+/// +dictionaryTransformerWithModelClass: or +arrayTransformerWithModelClass:
+/// itself, keeping the models still being decoded on a stack on the heap. This
+/// makes every level of nesting cheaper and allows decoding arbitrarily deep
+/// models, such as long chains of replies, on threads with small stacks. Other
+/// transformers are called as usual.
+///
+/// The result is the same as when decoding recursively. Nested models are
+/// decoded by adapters of the class the transformer was created from, as they
+/// would be by the transformer itself, and share the receiver's
+/// `interningContext` and `identityMap`. While the receiver decodes a model,
+/// the adapters of other nested transformers decode iteratively, too. Models
+/// are still decoded recursively while references are preserved, and nothing
+/// is decoded concurrently regardless of `parallelArrayThreshold`.
+///
+/// This property is NO by default.
+@property (nonatomic, assign) BOOL decodesIteratively;
+
+/// The resources the receiver may spend decoding a single model.
+///
+/// If not nil, -modelFromJSONDictionary:error:,
+/// -updateModel:withJSONDictionary:error: and
+/// -columnarModelArrayFromJSONArray:fieldMask:error: check the JSON values of
+/// properties and the models they create against the limits as they go, and
+/// fail with MTLJSONAdapterErrorLimitExceeded as soon as one is exceeded.
+///
+/// While the receiver decodes a model, its limits also apply to the adapters
+/// of nested transformers, whose own limits are ignored. JSON arrays and
+/// strings are checked before they are transformed. Dictionaries are only
+/// checked if they are used as they are, or decoded into models by an
+/// MTLJSONAdapter.
+///
+/// This property is nil by default.
+@property (nonatomic, copy, nullable) MTLJSONDecodingLimits *limits;
+
 /// Deserializes a model from a JSON dictionary.
 ///
 /// The adapter will call -validate: on the model and consider it an error if the
@@ -179,8 +423,93 @@ extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 /// model did not validate successfully.
 - (nullable __kindof Model)modelFromJSONDictionary:(NSDictionary<NSString *, id> *)JSONDictionary error:(NSError **)error;
 
+/// Deserializes only some properties of a model from a JSON dictionary.
+///
+/// Properties outside of `fieldMask` are not looked up, transformed or
+/// validated, and keep the values the model is initialized with. Since the
+/// resulting model is partial, -validate: is not called on it. The properties
+/// in the mask are still validated as they are set.
+///
+/// Each mask is compiled only once per adapter, so reusing the same masks is
+/// cheap.
+///
+/// JSONDictionary - A dictionary representing JSON data. This should match the
+///                  format returned by NSJSONSerialization. This argument must
+///                  not be nil.
+/// fieldMask      - The keys of the properties to decode. Key paths like
+///                  `owner.login` decode only the given properties of the
+///                  models nested in a property, if its transformer was
+///                  created with +dictionaryTransformerWithModelClass: or is
+///                  built on top of it. Keys which are not in
+///                  +JSONKeyPathsByPropertyKey are ignored. If nil, the model
+///                  is decoded in full.
+/// error          - If not NULL, this may be set to an error that occurs during
+///                  deserializing or validation.
+///
+/// Returns a model object, or nil if a deserialization error occurred.
+- (nullable __kindof Model)modelFromJSONDictionary:(NSDictionary<NSString *, id> *)JSONDictionary fieldMask:(nullable NSSet<NSString *> *)fieldMask error:(NSError **)error;
+
+/// Deserializes an array of JSON dictionaries into the columns of an
+/// MTLColumnarModelArray, without creating a model for each of them.
+///
+/// Every dictionary is decoded as an instance of the receiver's model class,
+/// using the same JSON key paths and transformers as
+/// -modelFromJSONDictionary:error:. +classForParsingJSONDictionary: is not
+/// consulted, and values are not validated until they are turned into models
+/// by -[MTLColumnarModelArray modelAtIndex:error:]. The `interningContext` and
+/// `identityMap` only apply to nested models. Nil values of properties stored
+/// as C arrays are stored as zero.
+///
+/// JSONArray - An array of dictionaries representing JSON data. This argument
+///             must not be nil.
+/// fieldMask - The keys of the properties to decode and store, in the same
+///             format as for -modelFromJSONDictionary:fieldMask:error:. If nil,
+///             all properties are stored.
+/// error     - If not NULL, this may be set to an error that occurs during
+///             deserializing.
+///
+/// Returns an array holding a model for every dictionary in `JSONArray`, or nil
+/// if a deserialization error occurred.
+- (nullable MTLColumnarModelArray<Model> *)columnarModelArrayFromJSONArray:(NSArray<NSDictionary<NSString *, id> *> *)JSONArray fieldMask:(nullable NSSet<NSString *> *)fieldMask error:(NSError **)error;
+
+/// Updates an existing model from a JSON dictionary which only contains some of
+/// its properties, like a partial object pushed over a socket.
+///
+/// Only the properties whose JSON key path is present in `JSONDictionary` are
+/// transformed, validated and set. A property mapped to several key paths is
+/// present if any of them is. All other properties keep their current values.
+/// A null value sets its property to nil.
+///
+/// If a property was created with +dictionaryTransformerWithModelClass:, its
+/// current value is a mutable model, and its JSON value is a dictionary, the
+/// nested model is updated in place the same way instead of being replaced.
+///
+/// Unlike -modelFromJSONDictionary:error:, this method does not consult
+/// +classForParsingJSONDictionary: and does not call -validate: on `model`.
+///
+/// model          - The model to update. This must be an instance of the
+///                  receiver's model class or a subclass thereof, and must not
+///                  be an immutable MTLModel. This argument must not be nil.
+/// JSONDictionary - A dictionary representing JSON data. This argument must
+///                  not be nil.
+/// error          - If not NULL, this may be set to an error that occurs during
+///                  deserializing or validation.
+///
+/// Returns whether `model` was updated successfully. If an error occurs, the
+/// properties preceding the failing one, in order of their keys, have already
+/// been updated.
+- (BOOL)updateModel:(Model)model withJSONDictionary:(NSDictionary<NSString *, id> *)JSONDictionary error:(NSError **)error;
+
 /// Serializes a model into JSON.
 ///
+/// The JSON dictionary of an MTLModel for which +isImmutable returns YES, and
+/// whose values are all immutable as described there, is only created once per
+/// adapter class, and reused whenever the model is serialized again, including
+/// as a nested model through +dictionaryTransformerWithModelClass:. Setting a
+/// property of the model through key-value coding discards the memoized
+/// dictionaries. Subclasses overriding -serializablePropertyKeys:forModel: must
+/// therefore return the same keys for the same immutable model every time.
+///
 /// model - The model to use for JSON serialization. This argument must not be
 ///         nil.
 /// error - If not NULL, this may be set to an error that occurs during
@@ -189,6 +518,76 @@ extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 /// Returns a model object, or nil if a serialization error occurred.
 - (nullable NSDictionary<NSString *, id> *)JSONDictionaryFromModel:(Model)model error:(NSError **)error;
 
+/// Serializes only some properties of a model into JSON.
+///
+/// Properties outside of `fieldMask` are not even read from `model`. Only the
+/// keys in the mask are passed to -serializablePropertyKeys:forModel:. The
+/// resulting dictionaries are not memoized, and `serializesChangesOnly`
+/// ignores the mask.
+///
+/// model     - The model to use for JSON serialization. This argument must not
+///             be nil.
+/// fieldMask - The keys of the properties to serialize, in the same format as
+///             for -modelFromJSONDictionary:fieldMask:error:. If nil, the model
+///             is serialized in full.
+/// error     - If not NULL, this may be set to an error that occurs during
+///             serializing.
+///
+/// Returns a JSON dictionary, or nil if a serialization error occurred.
+- (nullable NSDictionary<NSString *, id> *)JSONDictionaryFromModel:(Model)model fieldMask:(nullable NSSet<NSString *> *)fieldMask error:(NSError **)error;
+
+/// Serializes a model into canonical JSON data, which is the same for equal
+/// models in every run and every process.
+///
+/// The JSON dictionary from -JSONDictionaryFromModel:error: is encoded as
+/// UTF-8 in the form of RFC 8785 (JSON Canonicalization Scheme): object members
+/// are sorted by key, numbers are written in their shortest form which reads
+/// back as the same value, so that `@1` and `@1.0` are both written as `1`,
+/// strings only escape what JSON requires, and there is no whitespace. This
+/// makes the output suitable for caching, ETags and content addressing.
+///
+/// The encoding is done directly, without going through
+/// NSJSONSerialization.
+///
+/// model - The model to use for JSON serialization. This argument must not be
+///         nil.
+/// error - If not NULL, this may be set to an error that occurs during
+///         serializing. If a transformer produced a value that has no
+///         canonical JSON representation, like a date, a non-finite number or
+///         an integer beyond 2^53 which a double can't represent exactly, the
+///         error has the code MTLJSONAdapterErrorInvalidJSONValue.
+///
+/// Returns the canonical JSON data, or nil if a serialization error occurred.
+- (nullable NSData *)canonicalJSONDataFromModel:(Model)model error:(NSError **)error;
+
+/// Creates a JSON Patch (RFC 6902) which turns the JSON representation of one
+/// version of a model into that of another.
+///
+/// Properties are visited in order of their keys. Those whose values are
+/// identical or equal are skipped without serializing them. If both values of
+/// a property created with +dictionaryTransformerWithModelClass: are models of
+/// the same class, the nested JSON object is patched member by member, except
+/// that immutable models whose cached hashes match are skipped if they are
+/// equal. Any other changed property is serialized and replaced, added or
+/// removed as a whole, depending on whether it appears in the JSON of both
+/// models, only `newModel`, or only `oldModel`. Arrays are always replaced as
+/// a whole.
+///
+/// oldModel - The model whose JSON representation the patch applies to. This
+///            argument must not be nil.
+/// newModel - The model whose JSON representation results from applying the
+///            patch. This must be an instance of the receiver's model class
+///            or a subclass thereof. If it isn't an instance of the same class
+///            as `oldModel`, the patch replaces the whole document. This
+///            argument must not be nil.
+/// error    - If not NULL, this may be set to an error that occurs during
+///            serializing.
+///
+/// Returns an array of operations like
+/// `@{ @"op": @"replace", @"path": @"/user/name", @"value": @"foo" }`, which
+/// is empty if nothing changed, or nil if a serialization error occurred.
+- (nullable NSArray<NSDictionary<NSString *, id> *> *)JSONPatchFromModel:(Model)oldModel toModel:(Model)newModel error:(NSError **)error;
+
 /// Filters the property keys used to serialize a given model.
 ///
 /// propertyKeys - The property keys for which `model` provides a mapping.
@@ -212,7 +611,7 @@ extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 ///
 /// The default implementation invokes `+<class>JSONTransformer` on the
 /// receiver if it's implemented. It supports NSURL conversion through
-/// +NSURLJSONTransformer.
+/// +NSURLJSONTransformer, and NSUUID conversion through +NSUUIDJSONTransformer.
 ///
 /// modelClass - The class of the property to serialize. This property must not be
 ///              nil.
@@ -261,10 +660,70 @@ extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 /// transforming array elements back and forth.
 + (NSValueTransformer<MTLTransformerErrorHandling> *)arrayTransformerWithModelClass:(Class)modelClass;
 
+/// Creates a reversible transformer to convert the JSON dictionaries of an array
+/// which match a predicate into an array of MTLModel objects, and vice-versa.
+///
+/// The predicate is evaluated on the raw JSON of each element, as with
+/// +modelsOfClass:fromJSONArray:matchingPredicate:error:, and is prepared only
+/// once when the transformer is created. NSNull elements are kept if they match
+/// the predicate. Reverse transformations are not filtered.
+///
+/// modelClass - The MTLModel subclass to attempt to parse from each JSON
+///              dictionary. This class must conform to <MTLJSONSerializing>.
+///              This argument must not be nil.
+/// predicate  - The predicate an element must match to be decoded. If nil,
+///              this method is equivalent to +arrayTransformerWithModelClass:.
+///
+/// Returns a reversible transformer which only decodes the matching elements.
++ (NSValueTransformer<MTLTransformerErrorHandling> *)arrayTransformerWithModelClass:(Class)modelClass matchingPredicate:(nullable NSPredicate *)predicate;
+
+/// Creates a reversible transformer to convert an array of JSON dictionaries
+/// into a dictionary of MTLModel objects keyed by one of their properties, and
+/// vice-versa.
+///
+/// modelClass  - The MTLModel subclass to attempt to parse from each JSON
+///               dictionary. This class must conform to <MTLJSONSerializing>.
+///               This argument must not be nil.
+/// propertyKey - The property of the models whose value should be used as the
+///               key of each model in the resulting dictionary. Values of this
+///               property must conform to <NSCopying>. This argument must not
+///               be nil.
+///
+/// NSNull elements are skipped. A model without a value for `propertyKey`, or
+/// with the same value as an earlier model, fails the transformation with
+/// MTLTransformerErrorHandlingErrorInvalidInput. Reverse transformations produce
+/// an array of the dictionary's models ordered by key: string keys first, then
+/// number keys, each in ascending order.
+///
+/// Returns a reversible transformer which builds the dictionary directly as it
+/// decodes each array element.
++ (NSValueTransformer<MTLTransformerErrorHandling> *)arrayTransformerWithModelClass:(Class)modelClass keyedByPropertyKey:(NSString *)propertyKey;
+
+/// Creates a reversible transformer to convert a JSON dictionary whose values
+/// are JSON dictionaries into a dictionary of MTLModel objects with the same
+/// keys, and vice-versa.
+///
+/// This is useful for JSON which represents collections as maps, like
+/// `{"1": {"name": "foo"}, "2": {"name": "bar"}}`.
+///
+/// modelClass - The MTLModel subclass to attempt to parse from each JSON
+///              dictionary. This class must conform to <MTLJSONSerializing>.
+///              This argument must not be nil.
+///
+/// NSNull values are preserved in both directions.
+///
+/// Returns a reversible transformer which uses the class of the receiver for
+/// transforming dictionary values back and forth.
++ (NSValueTransformer<MTLTransformerErrorHandling> *)keyedDictionaryTransformerWithModelClass:(Class)modelClass;
+
 /// This value transformer is used by MTLJSONAdapter to automatically convert
 /// NSURL properties to JSON strings and vice versa.
 + (NSValueTransformer *)NSURLJSONTransformer;
 
+/// This value transformer is used by MTLJSONAdapter to automatically convert
+/// NSUUID properties to JSON strings and vice versa.
++ (NSValueTransformer *)NSUUIDJSONTransformer;
+
 @end
 
 @class MTLModel;
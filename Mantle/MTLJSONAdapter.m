@@ -7,22 +7,39 @@
 //
 
 #import <objc/runtime.h>
+#import <pthread.h>
+#import <stdatomic.h>
 
 #import "NSDictionary+MTLJSONKeyPath.h"
+#import "NSKeyValueCoding+MTLValidationAdditions.h"
 
 #import <Mantle/EXTRuntimeExtensions.h>
 #import <Mantle/EXTScope.h>
+#import "MTLCanonicalJSON.h"
+#import "MTLColumnarModelArray_Private.h"
+#import "MTLIdentityMap.h"
+#import "MTLInterningContext.h"
 #import "MTLJSONAdapter.h"
+#import "MTLJSONDecodingLimits.h"
 #import "MTLModel.h"
+#import "MTLModel+ChangeTracking.h"
+#import "MTLModel_Private.h"
 #import "MTLTransformerErrorHandling.h"
 #import "MTLReflection.h"
+#import "NSDictionary+MTLManipulationAdditions.h"
+#import "NSObject+MTLComparisonAdditions.h"
 #import "NSValueTransformer+MTLPredefinedTransformerAdditions.h"
-#import "MTLValueTransformer.h"
+#import "MTLValueTransformer_Private.h"
 
 NSString * const MTLJSONAdapterErrorDomain = @"MTLJSONAdapterErrorDomain";
 const NSInteger MTLJSONAdapterErrorNoClassFound = 2;
 const NSInteger MTLJSONAdapterErrorInvalidJSONDictionary = 3;
 const NSInteger MTLJSONAdapterErrorInvalidJSONMapping = 4;
+const NSInteger MTLJSONAdapterErrorInvalidJSONValue = 5;
+const NSInteger MTLJSONAdapterErrorUnresolvedReference = 6;
+const NSInteger MTLJSONAdapterErrorLimitExceeded = 7;
+
+NSString * const MTLJSONAdapterExceededLimitErrorKey = @"MTLJSONAdapterExceededLimit";
 
 // An exception was thrown and caught.
 const NSInteger MTLJSONAdapterErrorExceptionThrown = 1;
@@ -30,6 +47,535 @@ const NSInteger MTLJSONAdapterErrorExceptionThrown = 1;
 // Associated with the NSException that was caught.
 NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownException";
 
+// The limits of an MTLJSONDecodingLimits, copied so that they can be checked
+// cheaply, and the resources used against them while decoding a model graph.
+typedef struct {
+	NSUInteger maximumDepth;
+	NSUInteger maximumElementCount;
+	NSUInteger maximumArrayLength;
+	NSUInteger maximumStringLength;
+	NSUInteger maximumModelCount;
+
+	// Updated atomically, since arrays decoded concurrently share them.
+	_Atomic(NSUInteger) elementCount;
+	_Atomic(NSUInteger) modelCount;
+} MTLJSONDecodingUsage;
+
+// Settings which adapters decoding nested models inherit from the adapters
+// decoding the models containing them, unless they have their own.
+typedef struct {
+	__unsafe_unretained MTLInterningContext *interningContext;
+	__unsafe_unretained MTLIdentityMap *identityMap;
+
+	// The models decoded so far by their `$id`, if references are resolved.
+	__unsafe_unretained NSMutableDictionary *modelsByReferenceID;
+
+	// The field mask of the next model to decode, or nil to decode it in full.
+	// Unlike the other options, this is not inherited any further.
+	__unsafe_unretained NSSet *fieldMask;
+
+	// The number of elements from which JSON arrays are transformed on other
+	// threads, or 0 to transform everything on the current thread.
+	NSUInteger parallelArrayThreshold;
+
+	// Whether nested models are decoded with an explicit stack instead of by
+	// recursion.
+	BOOL decodesIteratively;
+
+	// The limits of the model graph being decoded, or NULL if there are none.
+	// Unlike the other options, these are never replaced by nested adapters.
+	MTLJSONDecodingUsage *usage;
+
+	// The number of models nested in each other down to the model being
+	// decoded, including it.
+	NSUInteger depth;
+} MTLJSONAdapterDecodingOptions;
+
+// Holds the MTLJSONAdapterDecodingOptions of the adapter decoding a model on
+// the current thread, if any.
+static pthread_key_t MTLJSONAdapterDecodingOptionsKey;
+
+static const MTLJSONAdapterDecodingOptions *MTLJSONAdapterCurrentDecodingOptions(void) {
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		pthread_key_create(&MTLJSONAdapterDecodingOptionsKey, NULL);
+	});
+
+	return pthread_getspecific(MTLJSONAdapterDecodingOptionsKey);
+}
+
+static void MTLJSONAdapterSetCurrentDecodingOptions(const MTLJSONAdapterDecodingOptions *options) {
+	pthread_setspecific(MTLJSONAdapterDecodingOptionsKey, options);
+}
+
+// Initializes `usage` with the given limits and no resources used, and returns
+// it.
+static MTLJSONDecodingUsage *MTLJSONDecodingUsageInit(MTLJSONDecodingUsage *usage, MTLJSONDecodingLimits *limits) {
+	usage->maximumDepth = limits.maximumDepth;
+	usage->maximumElementCount = limits.maximumElementCount;
+	usage->maximumArrayLength = limits.maximumArrayLength;
+	usage->maximumStringLength = limits.maximumStringLength;
+	usage->maximumModelCount = limits.maximumModelCount;
+
+	atomic_init(&usage->elementCount, 0);
+	atomic_init(&usage->modelCount, 0);
+
+	return usage;
+}
+
+// Sets `error` to an MTLJSONAdapterErrorLimitExceeded error for the property
+// `limitKey` of MTLJSONDecodingLimits, and returns NO.
+static BOOL MTLJSONDecodingLimitExceeded(NSString *limitKey, NSUInteger limit, NSError **error) {
+	if (error != NULL) {
+		NSDictionary *userInfo = @{
+			NSLocalizedDescriptionKey: NSLocalizedString(@"Decoding limit exceeded", @""),
+			NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"The JSON exceeds the %@ of %lu.", @""), limitKey, (unsigned long)limit],
+			MTLJSONAdapterExceededLimitErrorKey: limitKey,
+		};
+
+		*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorLimitExceeded userInfo:userInfo];
+	}
+
+	return NO;
+}
+
+// Counts a model at `depth` against the limits of `usage`.
+//
+// Returns NO and sets `error` if a limit is exceeded.
+static BOOL MTLJSONDecodingUsageAddModel(MTLJSONDecodingUsage *usage, NSUInteger depth, NSError **error) {
+	if (depth > usage->maximumDepth) return MTLJSONDecodingLimitExceeded(@"maximumDepth", usage->maximumDepth, error);
+
+	if (atomic_fetch_add_explicit(&usage->modelCount, 1, memory_order_relaxed) >= usage->maximumModelCount) {
+		return MTLJSONDecodingLimitExceeded(@"maximumModelCount", usage->maximumModelCount, error);
+	}
+
+	return YES;
+}
+
+// Counts a JSON value read at `depth`, and everything within it, against the
+// limits of `usage`.
+//
+// checksDictionaries - Whether to descend into dictionaries. Dictionaries which
+//                      are decoded into models are checked as they are decoded.
+//
+// Returns NO and sets `error` if a limit is exceeded.
+static BOOL MTLJSONDecodingUsageAddJSONValue(MTLJSONDecodingUsage *usage, id value, NSUInteger depth, BOOL checksDictionaries, NSError **error) {
+	if ([value isKindOfClass:NSString.class]) {
+		// Every UTF-16 code unit takes one to three bytes of UTF-8, so the exact
+		// length only has to be computed close to the limit.
+		NSUInteger length = [value length];
+
+		if (length > usage->maximumStringLength / 3 && (length > usage->maximumStringLength || [value lengthOfBytesUsingEncoding:NSUTF8StringEncoding] > usage->maximumStringLength)) {
+			return MTLJSONDecodingLimitExceeded(@"maximumStringLength", usage->maximumStringLength, error);
+		}
+
+		return YES;
+	}
+
+	BOOL isArray = [value isKindOfClass:NSArray.class];
+	if (!isArray && !(checksDictionaries && [value isKindOfClass:NSDictionary.class])) return YES;
+
+	if (depth + 1 > usage->maximumDepth) return MTLJSONDecodingLimitExceeded(@"maximumDepth", usage->maximumDepth, error);
+
+	if (isArray) {
+		NSUInteger count = [value count];
+		if (count > usage->maximumArrayLength) return MTLJSONDecodingLimitExceeded(@"maximumArrayLength", usage->maximumArrayLength, error);
+
+		if (atomic_fetch_add_explicit(&usage->elementCount, count, memory_order_relaxed) + count > usage->maximumElementCount) {
+			return MTLJSONDecodingLimitExceeded(@"maximumElementCount", usage->maximumElementCount, error);
+		}
+	} else {
+		value = [value objectEnumerator];
+	}
+
+	for (id element in value) {
+		if (!MTLJSONDecodingUsageAddJSONValue(usage, element, depth + 1, checksDictionaries, error)) return NO;
+	}
+
+	return YES;
+}
+
+// Settings which adapters serializing nested models inherit from the adapters
+// serializing the models containing them.
+typedef struct {
+	// The `$id` of every model serialized so far, keyed by identity, if
+	// references are written.
+	__unsafe_unretained NSMapTable *referenceIDsByModel;
+
+	// The field mask of the next model to serialize, or nil to serialize it in
+	// full. Unlike the other options, this is not inherited any further.
+	__unsafe_unretained NSSet *fieldMask;
+} MTLJSONAdapterEncodingOptions;
+
+// Holds the MTLJSONAdapterEncodingOptions of the adapter serializing a model
+// on the current thread, if any.
+static pthread_key_t MTLJSONAdapterEncodingOptionsKey;
+
+static const MTLJSONAdapterEncodingOptions *MTLJSONAdapterCurrentEncodingOptions(void) {
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		pthread_key_create(&MTLJSONAdapterEncodingOptionsKey, NULL);
+	});
+
+	return pthread_getspecific(MTLJSONAdapterEncodingOptionsKey);
+}
+
+static void MTLJSONAdapterSetCurrentEncodingOptions(const MTLJSONAdapterEncodingOptions *options) {
+	pthread_setspecific(MTLJSONAdapterEncodingOptionsKey, options);
+}
+
+// The JSON keys identifying a model, and referring to a model identified
+// before, if references are preserved.
+static NSString * const MTLJSONAdapterReferenceIDKey = @"$id";
+static NSString * const MTLJSONAdapterReferenceKey = @"$ref";
+
+// Associated in +dictionaryTransformerWithModelClass: with the model class
+// decoded by the returned transformer.
+static void *MTLNestedModelClassKey = &MTLNestedModelClassKey;
+
+// Associated in +arrayTransformerWithModelClass: with the model class of the
+// elements decoded by the returned transformer.
+static void *MTLNestedModelArrayClassKey = &MTLNestedModelArrayClassKey;
+
+// Associated in +dictionaryTransformerWithModelClass: and
+// +arrayTransformerWithModelClass: with the class of the adapters decoding the
+// nested models of the returned transformer.
+static void *MTLNestedAdapterClassKey = &MTLNestedAdapterClassKey;
+
+// Sets `value` at the JSON key path, or array of JSON key paths, of a property
+// in `JSONDictionary`, creating the dictionaries along the way. If there are
+// several key paths, `value` must be a dictionary keyed by them.
+static void MTLJSONDictionarySetValueForJSONKeyPaths(NSMutableDictionary *JSONDictionary, id value, id JSONKeyPaths) {
+	void (^createComponents)(id, NSString *) = ^(id obj, NSString *keyPath) {
+		NSArray *keyPathComponents = [keyPath componentsSeparatedByString:@"."];
+
+		// Set up dictionaries at each step of the key path.
+		for (NSString *component in keyPathComponents) {
+			if ([obj valueForKey:component] == nil) {
+				// Insert an empty mutable dictionary at this spot so that we
+				// can set the whole key path afterward.
+				[obj setValue:[NSMutableDictionary dictionary] forKey:component];
+			}
+
+			obj = [obj valueForKey:component];
+		}
+	};
+
+	if ([JSONKeyPaths isKindOfClass:NSString.class]) {
+		createComponents(JSONDictionary, JSONKeyPaths);
+
+		[JSONDictionary setValue:value forKeyPath:JSONKeyPaths];
+	}
+
+	if ([JSONKeyPaths isKindOfClass:NSArray.class]) {
+		for (NSString *JSONKeyPath in JSONKeyPaths) {
+			createComponents(JSONDictionary, JSONKeyPath);
+
+			[JSONDictionary setValue:value[JSONKeyPath] forKeyPath:JSONKeyPath];
+		}
+	}
+}
+
+// Returns an immutable copy of `JSONDictionary`, including the dictionaries
+// -JSONDictionaryFromModel:error: creates along JSON key paths, so that it can
+// be handed out more than once.
+static NSDictionary *MTLJSONDictionaryCopyingContainers(NSDictionary *JSONDictionary) {
+	NSMutableDictionary *result = nil;
+
+	for (NSString *key in JSONDictionary) {
+		id value = JSONDictionary[key];
+		if (![value isKindOfClass:NSMutableDictionary.class]) continue;
+
+		if (result == nil) result = [JSONDictionary mutableCopy];
+		result[key] = MTLJSONDictionaryCopyingContainers(value);
+	}
+
+	return [(result ?: JSONDictionary) copy];
+}
+
+// Appends the JSON Pointer (RFC 6901) of a dotted JSON key path to the pointer
+// `basePath`.
+static NSString *MTLJSONPointerByAppendingKeyPath(NSString *basePath, NSString *keyPath) {
+	NSMutableString *pointer = [basePath mutableCopy];
+
+	for (NSString *component in [keyPath componentsSeparatedByString:@"."]) {
+		NSString *escapedComponent = [[component stringByReplacingOccurrencesOfString:@"~" withString:@"~0"] stringByReplacingOccurrencesOfString:@"/" withString:@"~1"];
+		[pointer appendFormat:@"/%@", escapedComponent];
+	}
+
+	return pointer;
+}
+
+// Returns the key paths of all JSON objects containing one of `keyPaths`, like
+// `a` and `a.b` for `a.b.c`.
+static NSSet *MTLJSONParentKeyPaths(NSArray *keyPaths) {
+	NSMutableSet *parentKeyPaths = [NSMutableSet set];
+
+	for (NSString *keyPath in keyPaths) {
+		NSRange range = [keyPath rangeOfString:@"." options:NSBackwardsSearch];
+
+		while (range.location != NSNotFound) {
+			NSString *parentKeyPath = [keyPath substringToIndex:range.location];
+			if ([parentKeyPaths containsObject:parentKeyPath]) break;
+
+			[parentKeyPaths addObject:parentKeyPath];
+			range = [parentKeyPath rangeOfString:@"." options:NSBackwardsSearch];
+		}
+	}
+
+	return parentKeyPaths;
+}
+
+// Returns an expression which resolves the key path of `expression` as a JSON
+// key path, if it is a key path expression without collection operators, or
+// `expression` itself.
+static NSExpression *MTLJSONKeyPathExpression(NSExpression *expression) {
+	if (expression.expressionType != NSKeyPathExpressionType) return expression;
+	if ([expression.keyPath rangeOfString:@"@"].location != NSNotFound) return expression;
+
+	NSArray *components = [expression.keyPath componentsSeparatedByString:@"."];
+
+	return [NSExpression expressionForBlock:^ id (id JSONValue, NSArray *arguments, NSMutableDictionary *context) {
+		for (NSString *component in components) {
+			if (![JSONValue isKindOfClass:NSDictionary.class]) return nil;
+
+			JSONValue = JSONValue[component];
+		}
+
+		return (JSONValue == NSNull.null ? nil : JSONValue);
+	} arguments:@[]];
+}
+
+// Returns a copy of `predicate` which resolves its key paths as JSON key paths
+// on the JSON it is evaluated with, so that JSON of an unexpected shape doesn't
+// raise an exception. Comparisons over collections are left to key-value
+// coding.
+static NSPredicate *MTLJSONPredicate(NSPredicate *predicate) {
+	if ([predicate isKindOfClass:NSCompoundPredicate.class]) {
+		NSCompoundPredicate *compoundPredicate = (NSCompoundPredicate *)predicate;
+		NSMutableArray *subpredicates = [NSMutableArray arrayWithCapacity:compoundPredicate.subpredicates.count];
+
+		for (NSPredicate *subpredicate in compoundPredicate.subpredicates) {
+			[subpredicates addObject:MTLJSONPredicate(subpredicate)];
+		}
+
+		return [[NSCompoundPredicate alloc] initWithType:compoundPredicate.compoundPredicateType subpredicates:subpredicates];
+	}
+
+	if ([predicate isKindOfClass:NSComparisonPredicate.class]) {
+		NSComparisonPredicate *comparisonPredicate = (NSComparisonPredicate *)predicate;
+		if (comparisonPredicate.comparisonPredicateModifier != NSDirectPredicateModifier) return predicate;
+
+		NSExpression *leftExpression = MTLJSONKeyPathExpression(comparisonPredicate.leftExpression);
+		NSExpression *rightExpression = MTLJSONKeyPathExpression(comparisonPredicate.rightExpression);
+
+		if (comparisonPredicate.predicateOperatorType == NSCustomSelectorPredicateOperatorType) {
+			return [NSComparisonPredicate predicateWithLeftExpression:leftExpression rightExpression:rightExpression customSelector:comparisonPredicate.customSelector];
+		}
+
+		return [NSComparisonPredicate predicateWithLeftExpression:leftExpression rightExpression:rightExpression modifier:NSDirectPredicateModifier type:comparisonPredicate.predicateOperatorType options:comparisonPredicate.options];
+	}
+
+	return predicate;
+}
+
+// Orders the keys of keyed models, so that they are serialized the same way
+// every time. Strings come first, then numbers, then anything else, each in
+// their natural order.
+static NSComparisonResult MTLJSONCompareModelKeys(id key, id otherKey) {
+	NSInteger rank = ([key isKindOfClass:NSString.class] ? 0 : ([key isKindOfClass:NSNumber.class] ? 1 : 2));
+	NSInteger otherRank = ([otherKey isKindOfClass:NSString.class] ? 0 : ([otherKey isKindOfClass:NSNumber.class] ? 1 : 2));
+
+	if (rank != otherRank) return (rank < otherRank ? NSOrderedAscending : NSOrderedDescending);
+
+	switch (rank) {
+		case 0: return [key compare:otherKey options:NSLiteralSearch];
+		case 1: return [key compare:otherKey];
+		default: return [[key description] compare:[otherKey description] options:NSLiteralSearch];
+	}
+}
+
+// How MTLJSONAdapter converts between the JSON value of a property and the
+// value of the property itself.
+typedef NS_ENUM(NSInteger, MTLJSONPropertyConversion) {
+	// Values are passed through the transformer of the property, if any.
+	MTLJSONPropertyConversionTransformer,
+
+	// The transformer of the property was created by
+	// +mtl_validatingTransformerForClass:, so values of the validated class are
+	// used as they are.
+	MTLJSONPropertyConversionTypeCheck,
+
+	// The transformer of the property is the MTLBooleanValueTransformerName
+	// transformer, so numbers are converted to booleans directly.
+	MTLJSONPropertyConversionBoolean,
+};
+
+// Describes how a single property is mapped from and to JSON.
+//
+// MTLJSONAdapter creates these when it is initialized, so that information
+// which is the same for every model doesn't have to be looked up again for
+// each one.
+@interface MTLJSONPropertyMapping : NSObject
+
+// The key of the mapped property.
+@property (nonatomic, copy, readonly) NSString *propertyKey;
+
+// The JSON key path, or array of JSON key paths, of the property.
+@property (nonatomic, copy, readonly) id JSONKeyPaths;
+
+// The value transformer of the property, or nil if values are used as they
+// are.
+@property (nonatomic, strong, readonly) NSValueTransformer *transformer;
+
+// How values of the property are converted.
+@property (nonatomic, assign, readonly) MTLJSONPropertyConversion conversion;
+
+// Which values of the property are left out when serializing.
+@property (nonatomic, assign, readonly) MTLJSONOmissionPolicy omissionPolicy;
+
+// The value left out for MTLJSONOmissionPolicyDefaultValue, or nil if the
+// property has no default value.
+@property (nonatomic, strong, readonly) id defaultValue;
+
+// The class values must be a kind of for MTLJSONPropertyConversionTypeCheck.
+@property (nonatomic, strong, readonly) Class validatedClass;
+
+// The model class decoded by `transformer` if it was created by
+// +dictionaryTransformerWithModelClass:, or nil otherwise.
+@property (nonatomic, strong, readonly) Class nestedModelClass;
+
+// The model class of the elements decoded by `transformer` if it was created
+// by +arrayTransformerWithModelClass:, or nil otherwise.
+@property (nonatomic, strong, readonly) Class nestedModelArrayClass;
+
+// The class of the adapters `transformer` decodes nested models with, if
+// `nestedModelClass` or `nestedModelArrayClass` is set.
+@property (nonatomic, strong, readonly) Class nestedAdapterClass;
+
+// Whether `transformer` implements -transformedValue:success:error:.
+@property (nonatomic, assign, readonly) BOOL transformerHandlesErrors;
+
+// Whether `transformer` is used when serializing the property.
+@property (nonatomic, assign, readonly) BOOL allowsReverseTransformation;
+
+// Whether `transformer` implements -reverseTransformedValue:success:error:.
+@property (nonatomic, assign, readonly) BOOL transformerHandlesReverseErrors;
+
+- (instancetype)initWithPropertyKey:(NSString *)propertyKey JSONKeyPaths:(id)JSONKeyPaths transformer:(NSValueTransformer *)transformer omissionPolicy:(MTLJSONOmissionPolicy)omissionPolicy defaultValue:(id)defaultValue;
+
+// Converts a value from JSON, which must not be NSNull.
+//
+// success - Set to NO if the conversion fails.
+// error   - If not NULL, this may be set to an error that occurs during the
+//           conversion.
+//
+// Returns the converted value, which may be nil.
+- (id)transformedValue:(id)value success:(BOOL *)success error:(NSError **)error;
+
+// Converts a property value to JSON, which must not be NSNull.
+//
+// success - Set to NO if the conversion fails.
+// error   - If not NULL, this may be set to an error that occurs during the
+//           conversion.
+//
+// Returns the converted value, which may be nil.
+- (id)reverseTransformedValue:(id)value success:(BOOL *)success error:(NSError **)error;
+
+@end
+
+// The properties an MTLJSONAdapter processes for a field mask.
+//
+// MTLJSONAdapter compiles each field mask it is given into a plan only once,
+// so that applying the same mask again doesn't take any string processing.
+@interface MTLJSONFieldMaskPlan : NSObject
+
+// The mappings of the properties in the mask, sorted by property key.
+@property (nonatomic, copy, readonly) NSArray *propertyMappings;
+
+// The keys of `propertyMappings`.
+@property (nonatomic, copy, readonly) NSSet *propertyKeys;
+
+// The field masks of the nested models of properties of which the mask only
+// contains some key paths, keyed by property key.
+@property (nonatomic, copy, readonly) NSDictionary *nestedFieldMasksByPropertyKey;
+
+// Compiles `fieldMask` against the mappings of an adapter.
+//
+// fieldMask                     - The property keys and key paths to include.
+//                                 This argument must not be nil.
+// propertyMappingsByPropertyKey - The mappings of all properties of the
+//                                 adapter. Keys in `fieldMask` which do not
+//                                 have a mapping are ignored.
+- (instancetype)initWithFieldMask:(NSSet *)fieldMask propertyMappingsByPropertyKey:(NSDictionary *)propertyMappingsByPropertyKey;
+
+@end
+
+// A model being decoded by -iterativeModelFromJSONDictionary:fieldMask:error:.
+@interface MTLJSONDecodingFrame : NSObject
+
+// The adapter for the class of the model.
+@property (nonatomic, strong) MTLJSONAdapter *adapter;
+
+@property (nonatomic, strong) NSDictionary *JSONDictionary;
+
+// The plan for the field mask of the model, or nil if it is decoded in full.
+@property (nonatomic, strong) MTLJSONFieldMaskPlan *plan;
+
+// The mappings of the properties to decode.
+@property (nonatomic, strong) NSArray *propertyMappings;
+
+// The index in `propertyMappings` of the next property to decode.
+@property (nonatomic, assign) NSUInteger mappingIndex;
+
+// The property values decoded so far, keyed by property key.
+@property (nonatomic, strong) NSMutableDictionary *dictionaryValue;
+
+// The mapping of the property whose nested models are being decoded, or nil.
+@property (nonatomic, strong) MTLJSONPropertyMapping *nestedMapping;
+
+// The JSON array of `nestedMapping`, or nil if it holds a single model.
+@property (nonatomic, strong) NSArray *nestedJSONArray;
+
+// The index in `nestedJSONArray` of the next element to decode.
+@property (nonatomic, assign) NSUInteger nestedIndex;
+
+// The models decoded from `nestedJSONArray` so far.
+@property (nonatomic, strong) NSMutableArray *nestedModels;
+
+@end
+
+// The transform of the JSON value of a property which may run on another
+// thread, and its result.
+//
+// Only the work item performing the transform writes the result, and only
+// until it has finished.
+@interface MTLJSONParallelTransform : NSObject
+
+// The mapping of the transformed property.
+@property (nonatomic, strong) MTLJSONPropertyMapping *mapping;
+
+// The JSON value to transform.
+@property (nonatomic, strong) id JSONValue;
+
+// The field mask to decode nested models with, or nil to decode them in full.
+@property (nonatomic, copy) NSSet *nestedFieldMask;
+
+// The transformed value, or NSNull if it is nil.
+@property (nonatomic, strong) id value;
+
+// Whether the transform succeeded.
+@property (nonatomic, assign) BOOL success;
+
+// The error the transform failed with, if any.
+@property (nonatomic, strong) NSError *error;
+
+// The exception thrown by the transformer, if any. It is handled on the thread
+// waiting for the transform, in the order of the properties.
+@property (nonatomic, strong) NSException *exception;
+
+@end
+
 @interface MTLJSONAdapter ()
 
 // The MTLModel subclass being parsed, or the class of `model` if parsing has
@@ -42,9 +588,28 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 // A cached copy of the return value of -valueTransformersForModelClass:
 @property (nonatomic, copy, readonly) NSDictionary *valueTransformersByPropertyKey;
 
+// The MTLJSONPropertyMapping of every property in JSONKeyPathsByPropertyKey,
+// sorted by property key.
+@property (nonatomic, copy, readonly) NSArray *propertyMappings;
+
+// The objects of `propertyMappings`, keyed by their property key.
+@property (nonatomic, copy, readonly) NSDictionary *propertyMappingsByPropertyKey;
+
 // Used to cache the JSON adapters returned by -JSONAdapterForModelClass:error:.
 @property (nonatomic, strong, readonly) NSMapTable *JSONAdaptersByModelClass;
 
+// Used to cache the JSON adapters returned by
+// -JSONAdapterForModelClass:adapterClass:error: for adapter classes other than
+// the receiver's, keyed by adapter class and then by model class.
+@property (nonatomic, strong, readonly) NSMapTable *JSONAdaptersByAdapterClass;
+
+// Used to cache the plans returned by -planForFieldMask:, keyed by field mask.
+@property (nonatomic, strong, readonly) NSMutableDictionary *fieldMaskPlansByFieldMask;
+
+// Returns the plan for `fieldMask`, compiling it if necessary, or nil if
+// `fieldMask` is nil.
+- (MTLJSONFieldMaskPlan *)planForFieldMask:(NSSet *)fieldMask;
+
 // If +classForParsingJSONDictionary: returns a model class different from the
 // one this adapter was initialized with, use this method to obtain a cached
 // instance of a suitable adapter instead.
@@ -58,6 +623,134 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 // adapter could be created, nil is returned.
 - (MTLJSONAdapter *)JSONAdapterForModelClass:(Class)modelClass error:(NSError **)error;
 
+// Like -JSONAdapterForModelClass:error:, but returns an instance of
+// `adapterClass`, which must be MTLJSONAdapter or a subclass of it.
+- (MTLJSONAdapter *)JSONAdapterForModelClass:(Class)modelClass adapterClass:(Class)adapterClass error:(NSError **)error;
+
+// Deserializes a new model from a JSON dictionary, like
+// -modelFromJSONDictionary:fieldMask:error:, without consulting any interning
+// context or identity map.
+- (id)freshModelFromJSONDictionary:(NSDictionary *)JSONDictionary fieldMask:(NSSet *)fieldMask error:(NSError **)error;
+
+// Deserializes a model like -modelFromJSONDictionary:fieldMask:error:, but
+// decodes the nested models of properties using the transformers from
+// +dictionaryTransformerWithModelClass: and +arrayTransformerWithModelClass:
+// with an explicit stack instead of by recursion.
+//
+// The decoding options for the model must already be installed.
+- (id)iterativeModelFromJSONDictionary:(NSDictionary *)JSONDictionary fieldMask:(NSSet *)fieldMask error:(NSError **)error;
+
+// Returns a frame for decoding a model of `modelClass`, or of the class
+// returned by its +classForParsingJSONDictionary:, with an adapter of
+// `adapterClass`, or nil if an error occurred.
+//
+// The adapters of all frames are cached by the receiver.
+- (MTLJSONDecodingFrame *)decodingFrameForModelClass:(Class)modelClass adapterClass:(Class)adapterClass JSONDictionary:(NSDictionary *)JSONDictionary fieldMask:(NSSet *)fieldMask error:(NSError **)error;
+
+// Returns the class +classForParsingJSONDictionary: of the receiver's model
+// class returns for `JSONDictionary`, or the model class itself if it doesn't
+// implement it. If no class is returned, `error` is set and nil is returned.
+- (Class)modelClassForParsingJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error;
+
+// Creates a model of the receiver's model class from decoded property values,
+// validates it unless only the properties in `plan` were decoded, and
+// checkpoints its changes if it tracks them.
+- (id)modelWithDictionaryValue:(NSDictionary *)dictionaryValue plan:(MTLJSONFieldMaskPlan *)plan error:(NSError **)error;
+
+// Returns the model which is shared in place of `model` by the identity map
+// and interning context of `options`, if any. If only the properties in `plan`
+// were decoded, only those are merged into a model from the identity map.
+- (id)sharedModelForModel:(id)model plan:(MTLJSONFieldMaskPlan *)plan decodingOptions:(const MTLJSONAdapterDecodingOptions *)options;
+
+// Deserializes a new model identified by `referenceID`, which is registered in
+// `modelsByReferenceID` before any of its properties are decoded, so that they
+// can refer back to it. Only the properties in `plan` are decoded, unless it
+// is nil.
+- (id)referencedModelFromJSONDictionary:(NSDictionary *)JSONDictionary referenceID:(id)referenceID modelsByReferenceID:(NSMutableDictionary *)modelsByReferenceID plan:(MTLJSONFieldMaskPlan *)plan error:(NSError **)error;
+
+// Transforms the JSON values of `propertyMappings` into the dictionary value of
+// a model.
+//
+// JSON arrays of at least `options->parallelArrayThreshold` elements are
+// transformed concurrently on a global dispatch queue, unless references are
+// preserved or an identity map is used, while everything else is transformed
+// on the current thread. If several properties fail, `error` is
+// set to the error of the first one in `propertyMappings`.
+//
+// options - The decoding options of the current thread, or NULL.
+//
+// Returns the dictionary value, or nil if an error occurred.
+- (NSDictionary *)dictionaryValueFromJSONDictionary:(NSDictionary *)JSONDictionary propertyMappings:(NSArray *)propertyMappings plan:(MTLJSONFieldMaskPlan *)plan decodingOptions:(const MTLJSONAdapterDecodingOptions *)options error:(NSError **)error;
+
+// Serializes the value of a property, like -JSONDictionaryFromModel:error:.
+//
+// value   - The value of the property, which may be nil or NSNull.
+// mapping   - The mapping of the property. This argument must not be nil.
+// omitting  - Whether to apply the omission policy of the property.
+// success   - Set to NO if the value could not be serialized.
+// error     - If not NULL, this may be set to an error that occurs during
+//             serializing.
+//
+// Returns the JSON value, which may be nil if it is to be left out, or a
+// dictionary keyed by JSON key path if the property has several.
+- (id)JSONValueFromPropertyValue:(id)value forPropertyMapping:(MTLJSONPropertyMapping *)mapping omitting:(BOOL)omitting success:(BOOL *)success error:(NSError **)error;
+
+// Serializes the properties of `model`, which must be an instance of the
+// receiver's model class, which changed according to
+// -[MTLModel changedKeyPaths]. Models which changed in place are serialized
+// the same way.
+- (NSDictionary *)JSONDictionaryFromChangesOfModel:(MTLModel<MTLJSONSerializing> *)model error:(NSError **)error;
+
+// Appends the JSON Patch operations which turn the JSON representation of
+// `oldModel` into that of `newModel` to `operations`.
+//
+// Both models must be instances of the receiver's model class. The paths of
+// the operations are relative to the JSON Pointer `basePath`.
+//
+// Returns whether serializing the changed values succeeded.
+- (BOOL)appendJSONPatchOperationsFromModel:(id<MTLJSONSerializing>)oldModel toModel:(id<MTLJSONSerializing>)newModel basePath:(NSString *)basePath operations:(NSMutableArray *)operations error:(NSError **)error;
+
+// Looks up the JSON value of a property.
+//
+// mapping        - The mapping of the property. This argument must not be nil.
+// JSONDictionary - The dictionary to look up the value in. This argument must
+//                  not be nil.
+// success        - Set to NO if a key path could not be looked up.
+// error          - If not NULL, this may be set to an error that occurs during
+//                  the lookup.
+//
+// Returns the value at the JSON key path of `mapping`, or a dictionary of the
+// values of all its JSON key paths that are present if it has several. Returns
+// nil if the key path is not present.
+- (id)JSONValueForPropertyMapping:(MTLJSONPropertyMapping *)mapping fromJSONDictionary:(NSDictionary *)JSONDictionary success:(BOOL *)success error:(NSError **)error;
+
+// Converts the JSON value of a property into the value of the property.
+//
+// mapping         - The mapping of the property. This argument must not be nil.
+// JSONValue       - The value returned by
+//                   -JSONValueForPropertyMapping:fromJSONDictionary:success:error:.
+//                   This argument must not be nil.
+// JSONDictionary  - The dictionary `JSONValue` was looked up in, used for
+//                   logging exceptions.
+// nestedFieldMask - The field mask to decode nested models with, or nil to
+//                   decode them in full.
+// success         - Set to NO if the conversion fails.
+// error           - If not NULL, this may be set to an error that occurs
+//                   during the conversion.
+//
+// Returns the converted value, or NSNull if it is nil.
+- (id)propertyValueForPropertyMapping:(MTLJSONPropertyMapping *)mapping fromJSONValue:(id)JSONValue JSONDictionary:(NSDictionary *)JSONDictionary nestedFieldMask:(NSSet *)nestedFieldMask success:(BOOL *)success error:(NSError **)error;
+
+// Like -propertyValueForPropertyMapping:fromJSONValue:JSONDictionary:nestedFieldMask:success:error:,
+// but lets exceptions thrown by the transformer propagate to the caller.
+- (id)transformedValueForPropertyMapping:(MTLJSONPropertyMapping *)mapping fromJSONValue:(id)JSONValue nestedFieldMask:(NSSet *)nestedFieldMask success:(BOOL *)success error:(NSError **)error;
+
+// Logs an exception caught while converting the value of `mapping` from
+// `JSONDictionary`, and rethrows it if a debugger is attached.
+//
+// Otherwise, `error` is set to an MTLJSONAdapterErrorExceptionThrown error.
+- (void)handleException:(NSException *)exception parsingPropertyMapping:(MTLJSONPropertyMapping *)mapping fromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error;
+
 // Collect all value transformers needed for a given class.
 //
 // modelClass - The class from which to parse the JSON. This class must conform
@@ -80,6 +773,10 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 }
 
 + (NSArray *)modelsOfClass:(Class)modelClass fromJSONArray:(NSArray *)JSONArray error:(NSError **)error {
+	return [self modelsOfClass:modelClass fromJSONArray:JSONArray matchingPredicate:nil error:error];
+}
+
++ (NSArray *)modelsOfClass:(Class)modelClass fromJSONArray:(NSArray *)JSONArray matchingPredicate:(NSPredicate *)predicate error:(NSError **)error {
 	if (JSONArray == nil || ![JSONArray isKindOfClass:NSArray.class]) {
 		if (error != NULL) {
 			NSDictionary *userInfo = @{
@@ -91,8 +788,23 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 		return nil;
 	}
 
+	NSPredicate *JSONPredicate = (predicate != nil ? MTLJSONPredicate(predicate) : nil);
+
 	NSMutableArray *models = [NSMutableArray arrayWithCapacity:JSONArray.count];
 	for (NSDictionary *JSONDictionary in JSONArray){
+		if (![JSONDictionary isKindOfClass:NSDictionary.class]) {
+			if (error != NULL) {
+				NSDictionary *userInfo = @{
+					NSLocalizedDescriptionKey: NSLocalizedString(@"Missing JSON dictionary", @""),
+					NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"%@ could not be created because an invalid JSON dictionary was provided: %@", @""), NSStringFromClass(modelClass), JSONDictionary.class],
+				};
+				*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONDictionary userInfo:userInfo];
+			}
+			return nil;
+		}
+
+		if (JSONPredicate != nil && ![JSONPredicate evaluateWithObject:JSONDictionary]) continue;
+
 		MTLModel *model = [self modelOfClass:modelClass fromJSONDictionary:JSONDictionary error:error];
 
 		if (model == nil) return nil;
@@ -109,6 +821,12 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 	return [adapter JSONDictionaryFromModel:model error:error];
 }
 
++ (NSData *)canonicalJSONDataFromModel:(id<MTLJSONSerializing>)model error:(NSError **)error {
+	MTLJSONAdapter *adapter = [[self alloc] initWithModelClass:model.class];
+
+	return [adapter canonicalJSONDataFromModel:model error:error];
+}
+
 + (NSArray *)JSONArrayFromModels:(NSArray *)models error:(NSError **)error {
 	NSParameterAssert(models != nil);
 	NSParameterAssert([models isKindOfClass:NSArray.class]);
@@ -167,7 +885,30 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 
 	_valueTransformersByPropertyKey = [self.class valueTransformersForModelClass:modelClass];
 
+	MTLJSONOmissionPolicy omissionPolicy = MTLJSONOmissionPolicyNone;
+	if ([modelClass respondsToSelector:@selector(JSONOmissionPolicy)]) omissionPolicy = [modelClass JSONOmissionPolicy];
+
+	NSDictionary *omissionPoliciesByPropertyKey = nil;
+	if ([modelClass respondsToSelector:@selector(JSONOmissionPoliciesByPropertyKey)]) omissionPoliciesByPropertyKey = [modelClass JSONOmissionPoliciesByPropertyKey];
+
+	NSDictionary *defaultValuesByPropertyKey = nil;
+	if ([modelClass respondsToSelector:@selector(JSONDefaultValuesByPropertyKey)]) defaultValuesByPropertyKey = [modelClass JSONDefaultValuesByPropertyKey];
+
+	NSMutableDictionary *propertyMappingsByPropertyKey = [[NSMutableDictionary alloc] initWithCapacity:_JSONKeyPathsByPropertyKey.count];
+	for (NSString *propertyKey in _JSONKeyPathsByPropertyKey) {
+		NSNumber *propertyOmissionPolicy = omissionPoliciesByPropertyKey[propertyKey];
+
+		propertyMappingsByPropertyKey[propertyKey] = [[MTLJSONPropertyMapping alloc] initWithPropertyKey:propertyKey JSONKeyPaths:_JSONKeyPathsByPropertyKey[propertyKey] transformer:_valueTransformersByPropertyKey[propertyKey] omissionPolicy:(propertyOmissionPolicy != nil ? propertyOmissionPolicy.unsignedIntegerValue : omissionPolicy) defaultValue:defaultValuesByPropertyKey[propertyKey]];
+	}
+
+	_propertyMappingsByPropertyKey = [propertyMappingsByPropertyKey copy];
+	_propertyMappings = [propertyMappingsByPropertyKey.allValues sortedArrayUsingDescriptors:@[
+		[NSSortDescriptor sortDescriptorWithKey:@"propertyKey" ascending:YES]
+	]];
+
 	_JSONAdaptersByModelClass = [NSMapTable strongToStrongObjectsMapTable];
+	_JSONAdaptersByAdapterClass = [NSMapTable strongToStrongObjectsMapTable];
+	_fieldMaskPlansByFieldMask = [[NSMutableDictionary alloc] init];
 
 	return self;
 }
@@ -175,80 +916,123 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 #pragma mark Serialization
 
 - (NSDictionary *)JSONDictionaryFromModel:(id<MTLJSONSerializing>)model error:(NSError **)error {
+	// Nested models are serialized with the field mask of the property holding
+	// them.
+	const MTLJSONAdapterEncodingOptions *options = MTLJSONAdapterCurrentEncodingOptions();
+
+	return [self JSONDictionaryFromModel:model fieldMask:(options != NULL ? options->fieldMask : nil) error:error];
+}
+
+- (NSDictionary *)JSONDictionaryFromModel:(id<MTLJSONSerializing>)model fieldMask:(NSSet *)fieldMask error:(NSError **)error {
 	NSParameterAssert(model != nil);
 	NSParameterAssert([model isKindOfClass:self.modelClass]);
 
+	const MTLJSONAdapterEncodingOptions *options = MTLJSONAdapterCurrentEncodingOptions();
+
+	if (self.preservesReferences && (options == NULL || options->referenceIDsByModel == nil)) {
+		// Identify models across the whole graph serialized from here on.
+		NSMapTable *referenceIDsByModel = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory];
+		MTLJSONAdapterEncodingOptions referenceOptions = { referenceIDsByModel, nil };
+
+		MTLJSONAdapterSetCurrentEncodingOptions(&referenceOptions);
+		@onExit {
+			MTLJSONAdapterSetCurrentEncodingOptions(options);
+		};
+
+		return [self JSONDictionaryFromModel:model fieldMask:fieldMask error:error];
+	}
+
 	if (self.modelClass != model.class) {
 		MTLJSONAdapter *otherAdapter = [self JSONAdapterForModelClass:model.class error:error];
 
-		return [otherAdapter JSONDictionaryFromModel:model error:error];
+		return [otherAdapter JSONDictionaryFromModel:model fieldMask:fieldMask error:error];
 	}
 
-	NSSet *propertyKeysToSerialize = [self serializablePropertyKeys:[NSSet setWithArray:self.JSONKeyPathsByPropertyKey.allKeys] forModel:model];
+	MTLJSONFieldMaskPlan *plan = [self planForFieldMask:fieldMask];
 
-	NSDictionary *dictionaryValue = [model.dictionaryValue dictionaryWithValuesForKeys:propertyKeysToSerialize.allObjects];
-	NSMutableDictionary *JSONDictionary = [[NSMutableDictionary alloc] initWithCapacity:dictionaryValue.count];
+	// Pass field masks on to nested models only for the properties they were
+	// given for.
+	MTLJSONAdapterEncodingOptions nestedOptions = (options != NULL ? *options : (MTLJSONAdapterEncodingOptions){ nil, nil });
+	nestedOptions.fieldMask = nil;
 
-	__block BOOL success = YES;
-	__block NSError *tmpError = nil;
+	BOOL setsNestedOptions = (options != NULL && options->fieldMask != nil) || plan.nestedFieldMasksByPropertyKey.count > 0;
+	if (setsNestedOptions) MTLJSONAdapterSetCurrentEncodingOptions(&nestedOptions);
 
-	[dictionaryValue enumerateKeysAndObjectsUsingBlock:^(NSString *propertyKey, id value, BOOL *stop) {
-		id JSONKeyPaths = self.JSONKeyPathsByPropertyKey[propertyKey];
+	@onExit {
+		if (setsNestedOptions) MTLJSONAdapterSetCurrentEncodingOptions(options);
+	};
 
-		if (JSONKeyPaths == nil) return;
+	if (self.serializesChangesOnly && [model isKindOfClass:MTLModel.class]) {
+		return [self JSONDictionaryFromChangesOfModel:(MTLModel<MTLJSONSerializing> *)model error:error];
+	}
 
-		NSValueTransformer *transformer = self.valueTransformersByPropertyKey[propertyKey];
-		if ([transformer.class allowsReverseTransformation]) {
-			// Map NSNull -> nil for the transformer, and then back for the
-			// dictionaryValue we're going to insert into.
-			if ([value isEqual:NSNull.null]) value = nil;
+	NSMapTable *referenceIDsByModel = (options != NULL ? options->referenceIDsByModel : nil);
+	NSString *referenceID = nil;
 
-			if ([transformer respondsToSelector:@selector(reverseTransformedValue:success:error:)]) {
-				id<MTLTransformerErrorHandling> errorHandlingTransformer = (id)transformer;
+	if (referenceIDsByModel != nil) {
+		referenceID = [referenceIDsByModel objectForKey:model];
+		if (referenceID != nil) return @{ MTLJSONAdapterReferenceKey: referenceID };
 
-				value = [errorHandlingTransformer reverseTransformedValue:value success:&success error:&tmpError];
+		// Assign the ID before serializing any properties, so that cycles
+		// lead back to it.
+		referenceID = [NSString stringWithFormat:@"%lu", (unsigned long)referenceIDsByModel.count + 1];
+		[referenceIDsByModel setObject:referenceID forKey:model];
+	}
 
-				if (!success) {
-					*stop = YES;
-					return;
-				}
-			} else {
-				value = [transformer reverseTransformedValue:value] ?: NSNull.null;
-			}
-		}
+	// Immutable models serialize the same way every time, unless their JSON
+	// depends on the models serialized before them, or only some of their
+	// properties are serialized.
+	MTLModel *immutableModel = (referenceIDsByModel == nil && plan == nil && [model isKindOfClass:MTLModel.class] && [model.class isImmutable] ? (MTLModel *)model : nil);
 
-		void (^createComponents)(id, NSString *) = ^(id obj, NSString *keyPath) {
-			NSArray *keyPathComponents = [keyPath componentsSeparatedByString:@"."];
+	if (immutableModel != nil) {
+		NSDictionary *cachedJSONDictionary = immutableModel.cachedJSONDictionaries[self.class];
+		if (cachedJSONDictionary != nil) return cachedJSONDictionary;
+	}
 
-			// Set up dictionaries at each step of the key path.
-			for (NSString *component in keyPathComponents) {
-				if ([obj valueForKey:component] == nil) {
-					// Insert an empty mutable dictionary at this spot so that we
-					// can set the whole key path afterward.
-					[obj setValue:[NSMutableDictionary dictionary] forKey:component];
-				}
+	NSDictionary *dictionaryValue;
 
-				obj = [obj valueForKey:component];
-			}
-		};
+	if (plan != nil) {
+		// Don't even read the properties outside of the mask.
+		NSSet *propertyKeysToSerialize = [self serializablePropertyKeys:plan.propertyKeys forModel:model];
+		dictionaryValue = [(NSObject *)model dictionaryWithValuesForKeys:propertyKeysToSerialize.allObjects];
+	} else {
+		NSSet *propertyKeysToSerialize = [self serializablePropertyKeys:[NSSet setWithArray:self.JSONKeyPathsByPropertyKey.allKeys] forModel:model];
+		dictionaryValue = [model.dictionaryValue dictionaryWithValuesForKeys:propertyKeysToSerialize.allObjects];
+	}
+
+	NSMutableDictionary *JSONDictionary = [[NSMutableDictionary alloc] initWithCapacity:dictionaryValue.count];
 
-		if ([JSONKeyPaths isKindOfClass:NSString.class]) {
-			createComponents(JSONDictionary, JSONKeyPaths);
+	BOOL success = YES;
+	NSError *tmpError = nil;
 
-			[JSONDictionary setValue:value forKeyPath:JSONKeyPaths];
-		}
+	// Serialize in order of property keys, so that nested models are assigned
+	// the same reference IDs every time.
+	for (MTLJSONPropertyMapping *mapping in (plan != nil ? plan.propertyMappings : self.propertyMappings)) {
+		id value = dictionaryValue[mapping.propertyKey];
 
-		if ([JSONKeyPaths isKindOfClass:NSArray.class]) {
-			for (NSString *JSONKeyPath in JSONKeyPaths) {
-				createComponents(JSONDictionary, JSONKeyPath);
+		if (value == nil) continue;
 
-				[JSONDictionary setValue:value[JSONKeyPath] forKeyPath:JSONKeyPath];
-			}
-		}
-	}];
+		nestedOptions.fieldMask = plan.nestedFieldMasksByPropertyKey[mapping.propertyKey];
+		value = [self JSONValueFromPropertyValue:value forPropertyMapping:mapping omitting:YES success:&success error:&tmpError];
+		nestedOptions.fieldMask = nil;
+
+		if (!success) break;
+
+		MTLJSONDictionarySetValueForJSONKeyPaths(JSONDictionary, value, mapping.JSONKeyPaths);
+	}
 
 	if (success) {
-		return JSONDictionary;
+		if (referenceID != nil) JSONDictionary[MTLJSONAdapterReferenceIDKey] = referenceID;
+		if (immutableModel == nil) return JSONDictionary;
+
+		NSDictionary *result = MTLJSONDictionaryCopyingContainers(JSONDictionary);
+		NSDictionary *cachedJSONDictionaries = immutableModel.cachedJSONDictionaries ?: @{};
+
+		// It doesn't really matter if we replace another thread's work, since
+		// we do it atomically and the result should be the same.
+		immutableModel.cachedJSONDictionaries = [cachedJSONDictionaries mtl_dictionaryByAddingEntriesFromDictionary:@{ (id<NSCopying>)self.class: result }];
+
+		return result;
 	} else {
 		if (error != NULL) *error = tmpError;
 
@@ -256,108 +1040,996 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 	}
 }
 
-- (id)modelFromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error {
-	if ([self.modelClass respondsToSelector:@selector(classForParsingJSONDictionary:)]) {
-		Class class = [self.modelClass classForParsingJSONDictionary:JSONDictionary];
-		if (class == nil) {
-			if (error != NULL) {
-				NSDictionary *userInfo = @{
-					NSLocalizedDescriptionKey: NSLocalizedString(@"Could not parse JSON", @""),
-					NSLocalizedFailureReasonErrorKey: NSLocalizedString(@"No model class could be found to parse the JSON dictionary.", @"")
-				};
+- (NSDictionary *)JSONDictionaryFromChangesOfModel:(MTLModel<MTLJSONSerializing> *)model error:(NSError **)error {
+	// The keys of properties which changed as a whole, and of those holding
+	// models which changed.
+	NSMutableSet *changedPropertyKeys = [NSMutableSet set];
+	NSMutableSet *changedNestedModelKeys = [NSMutableSet set];
 
-				*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorNoClassFound userInfo:userInfo];
-			}
+	for (NSString *keyPath in model.changedKeyPaths) {
+		NSRange range = [keyPath rangeOfString:@"."];
 
-			return nil;
+		if (range.location == NSNotFound) {
+			[changedPropertyKeys addObject:keyPath];
+		} else {
+			[changedNestedModelKeys addObject:[keyPath substringToIndex:range.location]];
 		}
+	}
 
-		if (class != self.modelClass) {
-			NSAssert([class conformsToProtocol:@protocol(MTLJSONSerializing)], @"Class %@ returned from +classForParsingJSONDictionary: does not conform to <MTLJSONSerializing>", class);
+	NSSet *propertyKeysToSerialize = [self serializablePropertyKeys:[NSSet setWithArray:self.JSONKeyPathsByPropertyKey.allKeys] forModel:model];
+	NSMutableDictionary *JSONDictionary = [NSMutableDictionary dictionary];
 
-			MTLJSONAdapter *otherAdapter = [self JSONAdapterForModelClass:class error:error];
+	for (MTLJSONPropertyMapping *mapping in self.propertyMappings) {
+		NSString *propertyKey = mapping.propertyKey;
+		if (![propertyKeysToSerialize containsObject:propertyKey]) continue;
 
-			return [otherAdapter modelFromJSONDictionary:JSONDictionary error:error];
-		}
-	}
+		BOOL changedAsWhole = [changedPropertyKeys containsObject:propertyKey];
+		if (!changedAsWhole && ![changedNestedModelKeys containsObject:propertyKey]) continue;
 
-	NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:JSONDictionary.count];
+		id value = [model valueForKey:propertyKey];
 
-	for (NSString *propertyKey in [self.modelClass propertyKeys]) {
-		id JSONKeyPaths = self.JSONKeyPathsByPropertyKey[propertyKey];
+		if (!changedAsWhole && mapping.nestedModelClass != nil && [mapping.JSONKeyPaths isKindOfClass:NSString.class] && [value conformsToProtocol:@protocol(MTLJSONSerializing)]) {
+			MTLJSONAdapter *nestedAdapter = [self JSONAdapterForModelClass:[value class] error:error];
+			if (nestedAdapter == nil) return nil;
 
-		if (JSONKeyPaths == nil) continue;
+			value = [nestedAdapter JSONDictionaryFromChangesOfModel:value error:error];
+			if (value == nil) return nil;
+		} else {
+			BOOL success = YES;
+			value = [self JSONValueFromPropertyValue:value ?: NSNull.null forPropertyMapping:mapping omitting:NO success:&success error:error];
+
+			if (!success) return nil;
+		}
+
+		MTLJSONDictionarySetValueForJSONKeyPaths(JSONDictionary, value, mapping.JSONKeyPaths);
+	}
+
+	return JSONDictionary;
+}
+
+- (NSData *)canonicalJSONDataFromModel:(id<MTLJSONSerializing>)model error:(NSError **)error {
+	NSDictionary *JSONDictionary = [self JSONDictionaryFromModel:model error:error];
+	if (JSONDictionary == nil) return nil;
+
+	id invalidObject = nil;
+	NSData *data = MTLCanonicalJSONDataWithObject(JSONDictionary, &invalidObject);
+
+	if (data == nil && error != NULL) {
+		NSDictionary *userInfo = @{
+			NSLocalizedDescriptionKey: NSLocalizedString(@"Could not encode JSON", @""),
+			NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"%@ could not be encoded as canonical JSON because it contains an invalid value: %@", @""), model.class, invalidObject],
+		};
+
+		*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONValue userInfo:userInfo];
+	}
+
+	return data;
+}
+
+- (id)JSONValueFromPropertyValue:(id)value forPropertyMapping:(MTLJSONPropertyMapping *)mapping omitting:(BOOL)omitting success:(BOOL *)success error:(NSError **)error {
+	MTLJSONOmissionPolicy omissionPolicy = (omitting ? mapping.omissionPolicy : MTLJSONOmissionPolicyNone);
+
+	// Decide about omitting the property value before paying for its
+	// transformation.
+	if ((omissionPolicy & MTLJSONOmissionPolicyNil) != 0 && (value == nil || value == NSNull.null)) return nil;
+	if ((omissionPolicy & MTLJSONOmissionPolicyDefaultValue) != 0 && mapping.defaultValue != nil && MTLEqualObjects(value, mapping.defaultValue)) return nil;
+
+	if (mapping.allowsReverseTransformation) {
+		// Map NSNull -> nil for the transformer, and then back for the
+		// dictionaryValue we're going to insert into.
+		if ([value isEqual:NSNull.null]) value = nil;
+
+		value = [mapping reverseTransformedValue:value success:success error:error];
+
+		if (!*success) return nil;
+
+		if (!mapping.transformerHandlesReverseErrors && value == nil) value = NSNull.null;
+	}
+
+	if ((omissionPolicy & MTLJSONOmissionPolicyNull) != 0 && value == NSNull.null) return nil;
+
+	return value;
+}
+
+- (NSArray *)JSONPatchFromModel:(id<MTLJSONSerializing>)oldModel toModel:(id<MTLJSONSerializing>)newModel error:(NSError **)error {
+	NSParameterAssert(oldModel != nil);
+	NSParameterAssert(newModel != nil);
+	NSParameterAssert([newModel isKindOfClass:self.modelClass]);
+
+	if (oldModel.class != newModel.class) {
+		NSDictionary *JSONDictionary = [self JSONDictionaryFromModel:newModel error:error];
+		if (JSONDictionary == nil) return nil;
+
+		return @[ @{ @"op": @"replace", @"path": @"", @"value": JSONDictionary } ];
+	}
+
+	MTLJSONAdapter *adapter = self;
+
+	if (self.modelClass != newModel.class) {
+		adapter = [self JSONAdapterForModelClass:newModel.class error:error];
+		if (adapter == nil) return nil;
+	}
+
+	NSMutableArray *operations = [NSMutableArray array];
+	if (oldModel == newModel) return operations;
+
+	if (![adapter appendJSONPatchOperationsFromModel:oldModel toModel:newModel basePath:@"" operations:operations error:error]) return nil;
+
+	return operations;
+}
+
+- (BOOL)appendJSONPatchOperationsFromModel:(id<MTLJSONSerializing>)oldModel toModel:(id<MTLJSONSerializing>)newModel basePath:(NSString *)basePath operations:(NSMutableArray *)operations error:(NSError **)error {
+	NSSet *propertyKeys = [NSSet setWithArray:self.JSONKeyPathsByPropertyKey.allKeys];
+	NSSet *oldPropertyKeys = [self serializablePropertyKeys:propertyKeys forModel:oldModel];
+	NSSet *newPropertyKeys = [self serializablePropertyKeys:propertyKeys forModel:newModel];
+
+	// -JSONDictionaryFromModel:error: creates the JSON objects containing the
+	// key paths of all serialized properties, even those without a value.
+	NSMutableArray *oldKeyPaths = [NSMutableArray array];
+	NSMutableArray *newKeyPaths = [NSMutableArray array];
+
+	for (MTLJSONPropertyMapping *mapping in self.propertyMappings) {
+		NSArray *keyPaths = ([mapping.JSONKeyPaths isKindOfClass:NSArray.class] ? mapping.JSONKeyPaths : @[ mapping.JSONKeyPaths ]);
+
+		if ([oldPropertyKeys containsObject:mapping.propertyKey]) [oldKeyPaths addObjectsFromArray:keyPaths];
+		if ([newPropertyKeys containsObject:mapping.propertyKey]) [newKeyPaths addObjectsFromArray:keyPaths];
+	}
+
+	NSMutableSet *existingParentKeyPaths = [MTLJSONParentKeyPaths(oldKeyPaths) mutableCopy];
+
+	NSMutableSet *removedParentKeyPaths = [existingParentKeyPaths mutableCopy];
+	[removedParentKeyPaths minusSet:MTLJSONParentKeyPaths(newKeyPaths)];
+
+	BOOL (^isInRemovedParent)(NSString *) = ^(NSString *keyPath) {
+		for (NSString *parentKeyPath in removedParentKeyPaths) {
+			if ([keyPath hasPrefix:[parentKeyPath stringByAppendingString:@"."]]) return YES;
+		}
+
+		return NO;
+	};
+
+	for (MTLJSONPropertyMapping *mapping in self.propertyMappings) {
+		NSString *propertyKey = mapping.propertyKey;
+		id JSONKeyPaths = mapping.JSONKeyPaths;
+
+		BOOL inOldModel = [oldPropertyKeys containsObject:propertyKey];
+		BOOL inNewModel = [newPropertyKeys containsObject:propertyKey];
+		if (!inOldModel && !inNewModel) continue;
+
+		id oldValue = (inOldModel ? [(NSObject *)oldModel valueForKey:propertyKey] : nil);
+		id newValue = (inNewModel ? [(NSObject *)newModel valueForKey:propertyKey] : nil);
 
-		id value;
+		if (inOldModel && inNewModel) {
+			if (oldValue == newValue) continue;
 
-		if ([JSONKeyPaths isKindOfClass:NSArray.class]) {
-			NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+			if (mapping.nestedModelClass != nil && [JSONKeyPaths isKindOfClass:NSString.class] && [oldValue isKindOfClass:MTLModel.class] && [newValue isMemberOfClass:[oldValue class]] && [newValue conformsToProtocol:@protocol(MTLJSONSerializing)]) {
+				NSUInteger oldHash = [oldValue cachedHash];
+				if (oldHash != 0 && oldHash == [newValue cachedHash] && [oldValue isEqual:newValue]) continue;
 
-			for (NSString *keyPath in JSONKeyPaths) {
-				BOOL success = NO;
-				id value = [JSONDictionary mtl_valueForJSONKeyPath:keyPath success:&success error:error];
+				MTLJSONAdapter *nestedAdapter = [self JSONAdapterForModelClass:[newValue class] error:error];
+				if (nestedAdapter == nil) return NO;
 
-				if (!success) return nil;
+				if (![nestedAdapter appendJSONPatchOperationsFromModel:oldValue toModel:newValue basePath:MTLJSONPointerByAppendingKeyPath(basePath, JSONKeyPaths) operations:operations error:error]) return NO;
 
-				if (value != nil) dictionary[keyPath] = value;
+				continue;
 			}
 
-			value = dictionary;
-		} else {
-			BOOL success = NO;
-			value = [JSONDictionary mtl_valueForJSONKeyPath:JSONKeyPaths success:&success error:error];
+			if (MTLEqualObjects(oldValue, newValue)) continue;
+		}
 
-			if (!success) return nil;
+		BOOL success = YES;
+
+		id oldJSONValue = nil;
+		if (inOldModel) {
+			oldJSONValue = [self JSONValueFromPropertyValue:oldValue ?: NSNull.null forPropertyMapping:mapping omitting:YES success:&success error:error];
+			if (!success) return NO;
 		}
 
-		if (value == nil) continue;
+		id newJSONValue = nil;
+		if (inNewModel) {
+			newJSONValue = [self JSONValueFromPropertyValue:newValue ?: NSNull.null forPropertyMapping:mapping omitting:YES success:&success error:error];
+			if (!success) return NO;
+		}
 
-		@try {
-			NSValueTransformer *transformer = self.valueTransformersByPropertyKey[propertyKey];
-			if (transformer != nil) {
-				// Map NSNull -> nil for the transformer, and then back for the
-				// dictionary we're going to insert into.
-				if ([value isEqual:NSNull.null]) value = nil;
+		BOOL hasMultipleKeyPaths = [JSONKeyPaths isKindOfClass:NSArray.class];
+		if (hasMultipleKeyPaths) {
+			if (![oldJSONValue isKindOfClass:NSDictionary.class]) oldJSONValue = nil;
+			if (![newJSONValue isKindOfClass:NSDictionary.class]) newJSONValue = nil;
+		}
 
-				if ([transformer respondsToSelector:@selector(transformedValue:success:error:)]) {
-					id<MTLTransformerErrorHandling> errorHandlingTransformer = (id)transformer;
+		for (NSString *keyPath in (hasMultipleKeyPaths ? JSONKeyPaths : @[ JSONKeyPaths ])) {
+			id oldValueAtKeyPath = (hasMultipleKeyPaths ? oldJSONValue[keyPath] : oldJSONValue);
+			id newValueAtKeyPath = (hasMultipleKeyPaths ? newJSONValue[keyPath] : newJSONValue);
 
-					BOOL success = YES;
-					value = [errorHandlingTransformer transformedValue:value success:&success error:error];
+			if (MTLEqualObjects(oldValueAtKeyPath, newValueAtKeyPath)) continue;
+
+			// Removing the containing object takes care of the value.
+			if (isInRemovedParent(keyPath)) continue;
+
+			if (newValueAtKeyPath == nil) {
+				[operations addObject:@{ @"op": @"remove", @"path": MTLJSONPointerByAppendingKeyPath(basePath, keyPath) }];
+			} else if (oldValueAtKeyPath != nil) {
+				[operations addObject:@{ @"op": @"replace", @"path": MTLJSONPointerByAppendingKeyPath(basePath, keyPath), @"value": newValueAtKeyPath }];
+			} else {
+				// Adding a value requires its containing object to exist, so
+				// add the outermost missing one along with it instead.
+				NSArray *components = [keyPath componentsSeparatedByString:@"."];
+				NSUInteger addedCount = components.count;
 
-					if (!success) return nil;
-				} else {
-					value = [transformer transformedValue:value];
+				for (NSUInteger count = 1; count < components.count; count++) {
+					NSString *parentKeyPath = [[components subarrayWithRange:NSMakeRange(0, count)] componentsJoinedByString:@"."];
+					if ([existingParentKeyPaths containsObject:parentKeyPath]) continue;
+
+					addedCount = count;
+					break;
+				}
+
+				id value = newValueAtKeyPath;
+				for (NSUInteger index = components.count - 1; index >= addedCount; index--) {
+					value = @{ components[index]: value };
 				}
 
-				if (value == nil) value = NSNull.null;
+				for (NSUInteger count = addedCount; count < components.count; count++) {
+					[existingParentKeyPaths addObject:[[components subarrayWithRange:NSMakeRange(0, count)] componentsJoinedByString:@"."]];
+				}
+
+				NSString *addedKeyPath = [[components subarrayWithRange:NSMakeRange(0, addedCount)] componentsJoinedByString:@"."];
+				[operations addObject:@{ @"op": @"add", @"path": MTLJSONPointerByAppendingKeyPath(basePath, addedKeyPath), @"value": value }];
 			}
+		}
+	}
 
-			dictionaryValue[propertyKey] = value;
-		} @catch (NSException *ex) {
-			NSLog(@"*** Caught exception %@ parsing JSON key path \"%@\" from: %@", ex, JSONKeyPaths, JSONDictionary);
+	NSArray *sortedRemovedParentKeyPaths = [removedParentKeyPaths.allObjects sortedArrayUsingSelector:@selector(compare:)];
+
+	for (NSString *parentKeyPath in sortedRemovedParentKeyPaths) {
+		if (isInRemovedParent(parentKeyPath)) continue;
+
+		[operations addObject:@{ @"op": @"remove", @"path": MTLJSONPointerByAppendingKeyPath(basePath, parentKeyPath) }];
+	}
+
+	return YES;
+}
+
+- (id)modelFromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error {
+	// Nested models are decoded with the field mask of the property holding
+	// them.
+	const MTLJSONAdapterDecodingOptions *options = MTLJSONAdapterCurrentDecodingOptions();
+
+	return [self modelFromJSONDictionary:JSONDictionary fieldMask:(options != NULL ? options->fieldMask : nil) error:error];
+}
+
+- (id)modelFromJSONDictionary:(NSDictionary *)JSONDictionary fieldMask:(NSSet *)fieldMask error:(NSError **)error {
+	// Always read the current options first, since that creates their key.
+	const MTLJSONAdapterDecodingOptions *outerOptions = MTLJSONAdapterCurrentDecodingOptions();
+
+	MTLJSONAdapterDecodingOptions options = (outerOptions != NULL ? *outerOptions : (MTLJSONAdapterDecodingOptions){ nil, nil, nil, nil, 0, NO, NULL, 0 });
+	if (self.interningContext != nil) options.interningContext = self.interningContext;
+	if (self.identityMap != nil) options.identityMap = self.identityMap;
+	if (self.parallelArrayThreshold > 0) options.parallelArrayThreshold = self.parallelArrayThreshold;
+	if (self.decodesIteratively) options.decodesIteratively = YES;
+
+	MTLJSONDecodingUsage usage;
+	if (options.usage == NULL && self.limits != nil) options.usage = MTLJSONDecodingUsageInit(&usage, self.limits);
+	options.fieldMask = nil;
+
+	// Resolve references across the whole graph decoded from here on.
+	NSMutableDictionary *modelsByReferenceID = (self.preservesReferences && options.modelsByReferenceID == nil ? [NSMutableDictionary dictionary] : nil);
+	if (modelsByReferenceID != nil) options.modelsByReferenceID = modelsByReferenceID;
+
+	if (options.interningContext == nil && options.identityMap == nil && options.modelsByReferenceID == nil && options.parallelArrayThreshold == 0 && !options.decodesIteratively && options.usage == NULL && (outerOptions == NULL || outerOptions->fieldMask == nil)) {
+		return [self freshModelFromJSONDictionary:JSONDictionary fieldMask:fieldMask error:error];
+	}
+
+	MTLJSONAdapterSetCurrentDecodingOptions(&options);
+	@onExit {
+		MTLJSONAdapterSetCurrentDecodingOptions(outerOptions);
+	};
+
+	options.depth++;
 
-			// Fail fast in Debug builds.
-			if (MTLIsDebugging()) {
-				@throw ex;
-			} else if (error != NULL) {
+	// References are resolved by the recursive decoder only.
+	if (options.decodesIteratively && options.modelsByReferenceID == nil && [JSONDictionary isKindOfClass:NSDictionary.class]) {
+		if (options.usage != NULL && !MTLJSONDecodingUsageAddModel(options.usage, options.depth, error)) return nil;
+
+		return [self iterativeModelFromJSONDictionary:JSONDictionary fieldMask:fieldMask error:error];
+	}
+
+	id referenceID = nil;
+
+	if (options.modelsByReferenceID != nil && [JSONDictionary isKindOfClass:NSDictionary.class]) {
+		id reference = JSONDictionary[MTLJSONAdapterReferenceKey];
+
+		if (reference != nil) {
+			id referencedModel = options.modelsByReferenceID[reference];
+
+			if (referencedModel == nil && error != NULL) {
 				NSDictionary *userInfo = @{
-					NSLocalizedDescriptionKey: [NSString stringWithFormat:@"Caught exception parsing JSON key path \"%@\" for model class: %@", JSONKeyPaths, self.modelClass],
-					NSLocalizedRecoverySuggestionErrorKey: ex.description,
-					NSLocalizedFailureReasonErrorKey: ex.reason,
-					MTLJSONAdapterThrownExceptionErrorKey: ex
+					NSLocalizedDescriptionKey: NSLocalizedString(@"Could not resolve reference", @""),
+					NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"No model with the %@ \"%@\" was decoded before the reference to it.", @""), MTLJSONAdapterReferenceIDKey, reference],
 				};
 
-				*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorExceptionThrown userInfo:userInfo];
-			}
+				*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorUnresolvedReference userInfo:userInfo];
+			}
+
+			if (referencedModel != nil && ![referencedModel isKindOfClass:self.modelClass]) {
+				if (error != NULL) {
+					NSDictionary *userInfo = @{
+						NSLocalizedDescriptionKey: NSLocalizedString(@"Could not resolve reference", @""),
+						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"The model with the %@ \"%@\" is a %@, but a %@ was expected.", @""), MTLJSONAdapterReferenceIDKey, reference, [referencedModel class], self.modelClass],
+					};
+
+					*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorUnresolvedReference userInfo:userInfo];
+				}
+
+				return nil;
+			}
+
+			return referencedModel;
+		}
+
+		referenceID = JSONDictionary[MTLJSONAdapterReferenceIDKey];
+	}
+
+	if (options.usage != NULL && !MTLJSONDecodingUsageAddModel(options.usage, options.depth, error)) return nil;
+
+	id model = [self freshModelFromJSONDictionary:JSONDictionary fieldMask:fieldMask error:error];
+	if (model == nil) return nil;
+
+	model = [self sharedModelForModel:model plan:[self planForFieldMask:fieldMask] decodingOptions:&options];
+
+	// Later references resolve to the model that is actually returned.
+	if (referenceID != nil) options.modelsByReferenceID[referenceID] = model;
+
+	return model;
+}
+
+- (BOOL)updateModel:(id<MTLJSONSerializing>)model withJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error {
+	NSParameterAssert(model != nil);
+	NSParameterAssert([model isKindOfClass:self.modelClass]);
+	NSParameterAssert(![model isKindOfClass:MTLModel.class] || ![model.class isImmutable]);
+
+	if (model.class != self.modelClass) {
+		MTLJSONAdapter *otherAdapter = [self JSONAdapterForModelClass:model.class error:error];
+		if (otherAdapter == nil) return NO;
+
+		return [otherAdapter updateModel:model withJSONDictionary:JSONDictionary error:error];
+	}
+
+	if (![JSONDictionary isKindOfClass:NSDictionary.class]) {
+		if (error != NULL) {
+			NSDictionary *userInfo = @{
+				NSLocalizedDescriptionKey: NSLocalizedString(@"Missing JSON dictionary", @""),
+				NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"%@ could not be updated because an invalid JSON dictionary was provided: %@", @""), model.class, JSONDictionary.class],
+			};
+
+			*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONDictionary userInfo:userInfo];
+		}
+
+		return NO;
+	}
+
+	// Models decoded from scratch for nested properties use the same options as
+	// in -modelFromJSONDictionary:error:.
+	const MTLJSONAdapterDecodingOptions *outerOptions = MTLJSONAdapterCurrentDecodingOptions();
+
+	MTLJSONAdapterDecodingOptions options = (outerOptions != NULL ? *outerOptions : (MTLJSONAdapterDecodingOptions){ nil, nil, nil, nil, 0, NO, NULL, 0 });
+	if (self.interningContext != nil) options.interningContext = self.interningContext;
+	if (self.identityMap != nil) options.identityMap = self.identityMap;
+	if (self.parallelArrayThreshold > 0) options.parallelArrayThreshold = self.parallelArrayThreshold;
+	if (self.decodesIteratively) options.decodesIteratively = YES;
+
+	MTLJSONDecodingUsage usage;
+	if (options.usage == NULL && self.limits != nil) options.usage = MTLJSONDecodingUsageInit(&usage, self.limits);
+	options.fieldMask = nil;
+
+	NSMutableDictionary *modelsByReferenceID = (self.preservesReferences && options.modelsByReferenceID == nil ? [NSMutableDictionary dictionary] : nil);
+	if (modelsByReferenceID != nil) options.modelsByReferenceID = modelsByReferenceID;
+
+	MTLJSONAdapterSetCurrentDecodingOptions(&options);
+	@onExit {
+		MTLJSONAdapterSetCurrentDecodingOptions(outerOptions);
+	};
+
+	// The model is updated rather than created, so only its depth counts.
+	options.depth++;
+	if (options.usage != NULL && options.depth > options.usage->maximumDepth) return MTLJSONDecodingLimitExceeded(@"maximumDepth", options.usage->maximumDepth, error);
+
+	for (MTLJSONPropertyMapping *mapping in self.propertyMappings) {
+		BOOL success = YES;
+		id value = [self JSONValueForPropertyMapping:mapping fromJSONDictionary:JSONDictionary success:&success error:error];
+
+		if (!success) return NO;
+		if (value == nil || ([mapping.JSONKeyPaths isKindOfClass:NSArray.class] && [value count] == 0)) continue;
+
+		if (mapping.nestedModelClass != nil && [value isKindOfClass:NSDictionary.class] && !(options.modelsByReferenceID != nil && value[MTLJSONAdapterReferenceKey] != nil)) {
+			id nestedModel = [(NSObject *)model valueForKey:mapping.propertyKey];
+
+			if ([nestedModel isKindOfClass:mapping.nestedModelClass] && !([nestedModel isKindOfClass:MTLModel.class] && [[nestedModel class] isImmutable])) {
+				MTLJSONAdapter *nestedAdapter = [self JSONAdapterForModelClass:[nestedModel class] error:error];
+				if (nestedAdapter == nil) return NO;
+
+				if (![nestedAdapter updateModel:nestedModel withJSONDictionary:value error:error]) return NO;
+
+				continue;
+			}
+		}
+
+		value = [self propertyValueForPropertyMapping:mapping fromJSONValue:value JSONDictionary:JSONDictionary nestedFieldMask:nil success:&success error:error];
+
+		if (!success) return NO;
+
+		if ([value isEqual:NSNull.null]) value = nil;
+
+		if (!MTLValidateAndSetValue(model, mapping.propertyKey, value, YES, error)) return NO;
+	}
+
+	return YES;
+}
+
+- (MTLColumnarModelArray *)columnarModelArrayFromJSONArray:(NSArray *)JSONArray fieldMask:(NSSet *)fieldMask error:(NSError **)error {
+	NSParameterAssert(JSONArray != nil);
+
+	if (![JSONArray isKindOfClass:NSArray.class]) {
+		if (error != NULL) {
+			NSDictionary *userInfo = @{
+				NSLocalizedDescriptionKey: NSLocalizedString(@"Missing JSON array", @""),
+				NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"%@ could not be created because an invalid JSON array was provided: %@", @""), NSStringFromClass(self.modelClass), JSONArray.class],
+			};
+
+			*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONDictionary userInfo:userInfo];
+		}
+
+		return nil;
+	}
+
+	MTLJSONFieldMaskPlan *plan = [self planForFieldMask:fieldMask];
+	NSArray *propertyMappings = (plan != nil ? plan.propertyMappings : self.propertyMappings);
+
+	MTLColumnarModelArray *modelArray = [[MTLColumnarModelArray alloc] initWithModelClass:self.modelClass propertyKeys:[propertyMappings valueForKey:@"propertyKey"] capacity:JSONArray.count validatesModels:(plan == nil)];
+
+	// Nested models use the same options as in -modelFromJSONDictionary:error:.
+	const MTLJSONAdapterDecodingOptions *outerOptions = MTLJSONAdapterCurrentDecodingOptions();
+
+	MTLJSONAdapterDecodingOptions options = (outerOptions != NULL ? *outerOptions : (MTLJSONAdapterDecodingOptions){ nil, nil, nil, nil, 0, NO, NULL, 0 });
+	if (self.interningContext != nil) options.interningContext = self.interningContext;
+	if (self.identityMap != nil) options.identityMap = self.identityMap;
+	if (self.parallelArrayThreshold > 0) options.parallelArrayThreshold = self.parallelArrayThreshold;
+	if (self.decodesIteratively) options.decodesIteratively = YES;
+
+	MTLJSONDecodingUsage usage;
+	if (options.usage == NULL && self.limits != nil) options.usage = MTLJSONDecodingUsageInit(&usage, self.limits);
+	options.fieldMask = nil;
+
+	NSMutableDictionary *modelsByReferenceID = (self.preservesReferences && options.modelsByReferenceID == nil ? [NSMutableDictionary dictionary] : nil);
+	if (modelsByReferenceID != nil) options.modelsByReferenceID = modelsByReferenceID;
+
+	MTLJSONAdapterSetCurrentDecodingOptions(&options);
+	@onExit {
+		MTLJSONAdapterSetCurrentDecodingOptions(outerOptions);
+	};
+
+	if (options.usage != NULL && !MTLJSONDecodingUsageAddJSONValue(options.usage, JSONArray, options.depth, NO, error)) return nil;
+
+	// Every row counts as a model nested within the array.
+	options.depth++;
+
+	for (NSDictionary *JSONDictionary in JSONArray) {
+		if (![JSONDictionary isKindOfClass:NSDictionary.class]) {
+			if (error != NULL) {
+				NSDictionary *userInfo = @{
+					NSLocalizedDescriptionKey: NSLocalizedString(@"Missing JSON dictionary", @""),
+					NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"%@ could not be created because an invalid JSON dictionary was provided: %@", @""), NSStringFromClass(self.modelClass), JSONDictionary.class],
+				};
+
+				*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONDictionary userInfo:userInfo];
+			}
+
+			return nil;
+		}
+
+		if (options.usage != NULL && !MTLJSONDecodingUsageAddModel(options.usage, options.depth, error)) return nil;
+
+		[modelArray appendRow];
+
+		for (NSUInteger columnIndex = 0; columnIndex < propertyMappings.count; columnIndex++) {
+			MTLJSONPropertyMapping *mapping = propertyMappings[columnIndex];
+
+			BOOL success = YES;
+			id value = [self JSONValueForPropertyMapping:mapping fromJSONDictionary:JSONDictionary success:&success error:error];
+
+			if (!success) return nil;
+			if (value == nil) continue;
+
+			value = [self propertyValueForPropertyMapping:mapping fromJSONValue:value JSONDictionary:JSONDictionary nestedFieldMask:plan.nestedFieldMasksByPropertyKey[mapping.propertyKey] success:&success error:error];
+
+			if (!success) return nil;
+
+			if (![modelArray setValue:value forColumnAtIndex:columnIndex]) {
+				if (error != NULL) {
+					NSDictionary *userInfo = @{
+						NSLocalizedDescriptionKey: NSLocalizedString(@"Could not store value", @""),
+						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected a number for the %@ property of %@, got: %@", @""), mapping.propertyKey, NSStringFromClass(self.modelClass), value],
+					};
+
+					*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONDictionary userInfo:userInfo];
+				}
+
+				return nil;
+			}
+		}
+	}
+
+	return modelArray;
+}
+
+- (Class)modelClassForParsingJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error {
+	if (![self.modelClass respondsToSelector:@selector(classForParsingJSONDictionary:)]) return self.modelClass;
+
+	Class class = [self.modelClass classForParsingJSONDictionary:JSONDictionary];
+	if (class == nil) {
+		if (error != NULL) {
+			NSDictionary *userInfo = @{
+				NSLocalizedDescriptionKey: NSLocalizedString(@"Could not parse JSON", @""),
+				NSLocalizedFailureReasonErrorKey: NSLocalizedString(@"No model class could be found to parse the JSON dictionary.", @"")
+			};
+
+			*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorNoClassFound userInfo:userInfo];
+		}
+
+		return nil;
+	}
+
+	NSAssert(class == self.modelClass || [class conformsToProtocol:@protocol(MTLJSONSerializing)], @"Class %@ returned from +classForParsingJSONDictionary: does not conform to <MTLJSONSerializing>", class);
+
+	return class;
+}
+
+- (id)freshModelFromJSONDictionary:(NSDictionary *)JSONDictionary fieldMask:(NSSet *)fieldMask error:(NSError **)error {
+	Class class = [self modelClassForParsingJSONDictionary:JSONDictionary error:error];
+	if (class == nil) return nil;
+
+	if (class != self.modelClass) {
+		MTLJSONAdapter *otherAdapter = [self JSONAdapterForModelClass:class error:error];
+
+		return [otherAdapter modelFromJSONDictionary:JSONDictionary fieldMask:fieldMask error:error];
+	}
+
+	MTLJSONFieldMaskPlan *plan = [self planForFieldMask:fieldMask];
+
+	const MTLJSONAdapterDecodingOptions *options = MTLJSONAdapterCurrentDecodingOptions();
+	id referenceID = (options != NULL && options->modelsByReferenceID != nil ? JSONDictionary[MTLJSONAdapterReferenceIDKey] : nil);
+
+	if (referenceID != nil) {
+		return [self referencedModelFromJSONDictionary:JSONDictionary referenceID:referenceID modelsByReferenceID:options->modelsByReferenceID plan:plan error:error];
+	}
+
+	NSDictionary *dictionaryValue = [self dictionaryValueFromJSONDictionary:JSONDictionary propertyMappings:(plan != nil ? plan.propertyMappings : self.propertyMappings) plan:plan decodingOptions:options error:error];
+	if (dictionaryValue == nil) return nil;
+
+	return [self modelWithDictionaryValue:dictionaryValue plan:plan error:error];
+}
+
+- (id)modelWithDictionaryValue:(NSDictionary *)dictionaryValue plan:(MTLJSONFieldMaskPlan *)plan error:(NSError **)error {
+	id model = [self.modelClass modelWithDictionary:dictionaryValue error:error];
+	if (model == nil) return nil;
+
+	// Partial models are likely to fail validations of the properties they
+	// lack. The properties they have were validated when they were set.
+	if (plan == nil && ![model validate:error]) return nil;
+
+	if ([model isKindOfClass:MTLModel.class] && [[model class] tracksChanges]) [model checkpointChanges];
+
+	return model;
+}
+
+- (id)sharedModelForModel:(id)model plan:(MTLJSONFieldMaskPlan *)plan decodingOptions:(const MTLJSONAdapterDecodingOptions *)options {
+	Class modelClass = [model class];
+
+	if (options->identityMap != nil && [modelClass respondsToSelector:@selector(primaryKeyPropertyKey)]) {
+		id primaryKey = [model valueForKey:[modelClass primaryKeyPropertyKey]];
+		if (primaryKey != nil) model = [options->identityMap upsertModel:model forPrimaryKey:primaryKey propertyKeys:plan.propertyKeys];
+	}
+
+	if (options->interningContext != nil) model = [options->interningContext internModel:model];
+
+	return model;
+}
+
+- (id)iterativeModelFromJSONDictionary:(NSDictionary *)JSONDictionary fieldMask:(NSSet *)fieldMask error:(NSError **)error {
+	const MTLJSONAdapterDecodingOptions *options = MTLJSONAdapterCurrentDecodingOptions();
+	NSParameterAssert(options != NULL);
+
+	MTLJSONDecodingFrame *rootFrame = [self decodingFrameForModelClass:self.modelClass adapterClass:self.class JSONDictionary:JSONDictionary fieldMask:fieldMask error:error];
+	if (rootFrame == nil) return nil;
+
+	NSMutableArray *stack = [NSMutableArray arrayWithObject:rootFrame];
+
+	// Transformers and limits see the depth of the frame being processed.
+	MTLJSONAdapterDecodingOptions frameOptions = *options;
+
+	MTLJSONAdapterSetCurrentDecodingOptions(&frameOptions);
+	@onExit {
+		MTLJSONAdapterSetCurrentDecodingOptions(options);
+	};
+
+	while (YES) {
+		MTLJSONDecodingFrame *frame = stack.lastObject;
+		frameOptions.depth = options->depth + stack.count - 1;
+
+		if (frame.nestedJSONArray != nil) {
+			if (frame.nestedIndex == frame.nestedJSONArray.count) {
+				frame.dictionaryValue[frame.nestedMapping.propertyKey] = frame.nestedModels;
+
+				frame.nestedMapping = nil;
+				frame.nestedJSONArray = nil;
+				frame.nestedModels = nil;
+				continue;
+			}
+
+			id element = frame.nestedJSONArray[frame.nestedIndex++];
+
+			if (element == NSNull.null) {
+				[frame.nestedModels addObject:NSNull.null];
+				continue;
+			}
+
+			if (![element isKindOfClass:NSDictionary.class]) {
+				if (error != NULL) {
+					NSDictionary *userInfo = @{
+						NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert JSON array to model array", @""),
+						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSDictionary or an NSNull, got: %@.", @""), element],
+						MTLTransformerErrorHandlingInputValueErrorKey : element
+					};
+
+					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+				}
+
+				return nil;
+			}
+
+			if (options->usage != NULL && !MTLJSONDecodingUsageAddModel(options->usage, options->depth + stack.count, error)) return nil;
+
+			MTLJSONDecodingFrame *elementFrame = nil;
+
+			// Nested models are decoded within the transformer of the property
+			// when decoding recursively, which turns exceptions into errors.
+			@try {
+				elementFrame = [self decodingFrameForModelClass:frame.nestedMapping.nestedModelArrayClass adapterClass:frame.nestedMapping.nestedAdapterClass JSONDictionary:element fieldMask:frame.plan.nestedFieldMasksByPropertyKey[frame.nestedMapping.propertyKey] error:error];
+			} @catch (NSException *ex) {
+				[frame.adapter handleException:ex parsingPropertyMapping:frame.nestedMapping fromJSONDictionary:frame.JSONDictionary error:error];
+			}
+
+			if (elementFrame == nil) return nil;
+
+			[stack addObject:elementFrame];
+			continue;
+		}
+
+		if (frame.mappingIndex < frame.propertyMappings.count) {
+			MTLJSONPropertyMapping *mapping = frame.propertyMappings[frame.mappingIndex++];
+
+			BOOL success = YES;
+			id value = [frame.adapter JSONValueForPropertyMapping:mapping fromJSONDictionary:frame.JSONDictionary success:&success error:error];
+
+			if (!success) return nil;
+			if (value == nil) continue;
+
+			NSSet *nestedFieldMask = frame.plan.nestedFieldMasksByPropertyKey[mapping.propertyKey];
+
+			// Anything but well-formed nested models is left to the transformer,
+			// which also reports any errors.
+			if (mapping.nestedModelClass != nil && [value isKindOfClass:NSDictionary.class]) {
+				if (options->usage != NULL && !MTLJSONDecodingUsageAddModel(options->usage, options->depth + stack.count, error)) return nil;
+
+				MTLJSONDecodingFrame *nestedFrame = nil;
+
+				@try {
+					nestedFrame = [self decodingFrameForModelClass:mapping.nestedModelClass adapterClass:mapping.nestedAdapterClass JSONDictionary:value fieldMask:nestedFieldMask error:error];
+				} @catch (NSException *ex) {
+					[frame.adapter handleException:ex parsingPropertyMapping:mapping fromJSONDictionary:frame.JSONDictionary error:error];
+				}
+
+				if (nestedFrame == nil) return nil;
+
+				frame.nestedMapping = mapping;
+				[stack addObject:nestedFrame];
+				continue;
+			}
+
+			if (mapping.nestedModelArrayClass != nil && [value isKindOfClass:NSArray.class]) {
+				frame.nestedMapping = mapping;
+				frame.nestedJSONArray = value;
+				frame.nestedIndex = 0;
+				frame.nestedModels = [NSMutableArray arrayWithCapacity:[value count]];
+				continue;
+			}
+
+			value = [frame.adapter propertyValueForPropertyMapping:mapping fromJSONValue:value JSONDictionary:frame.JSONDictionary nestedFieldMask:nestedFieldMask success:&success error:error];
+
+			if (!success) return nil;
+
+			frame.dictionaryValue[mapping.propertyKey] = value;
+			continue;
+		}
+
+		id model = nil;
+
+		@try {
+			model = [frame.adapter modelWithDictionaryValue:frame.dictionaryValue plan:frame.plan error:error];
+		} @catch (NSException *ex) {
+			// Exceptions of the root model propagate, as when decoding
+			// recursively.
+			if (stack.count == 1) @throw;
+
+			MTLJSONDecodingFrame *parentFrame = stack[stack.count - 2];
+			[parentFrame.adapter handleException:ex parsingPropertyMapping:parentFrame.nestedMapping fromJSONDictionary:parentFrame.JSONDictionary error:error];
+		}
+
+		if (model == nil) return nil;
+
+		model = [self sharedModelForModel:model plan:frame.plan decodingOptions:options];
+
+		[stack removeLastObject];
+
+		MTLJSONDecodingFrame *parentFrame = stack.lastObject;
+		if (parentFrame == nil) return model;
+
+		if (parentFrame.nestedJSONArray != nil) {
+			[parentFrame.nestedModels addObject:model];
+		} else {
+			parentFrame.dictionaryValue[parentFrame.nestedMapping.propertyKey] = model;
+			parentFrame.nestedMapping = nil;
+		}
+	}
+}
+
+- (MTLJSONDecodingFrame *)decodingFrameForModelClass:(Class)modelClass adapterClass:(Class)adapterClass JSONDictionary:(NSDictionary *)JSONDictionary fieldMask:(NSSet *)fieldMask error:(NSError **)error {
+	MTLJSONAdapter *adapter = (modelClass == self.modelClass && adapterClass == self.class ? self : [self JSONAdapterForModelClass:modelClass adapterClass:adapterClass error:error]);
+	if (adapter == nil) return nil;
+
+	Class class = [adapter modelClassForParsingJSONDictionary:JSONDictionary error:error];
+	if (class == nil) return nil;
+
+	if (class != adapter.modelClass) {
+		adapter = (class == self.modelClass && adapterClass == self.class ? self : [self JSONAdapterForModelClass:class adapterClass:adapterClass error:error]);
+		if (adapter == nil) return nil;
+	}
+
+	MTLJSONDecodingFrame *frame = [[MTLJSONDecodingFrame alloc] init];
+	frame.adapter = adapter;
+	frame.JSONDictionary = JSONDictionary;
+	frame.plan = [adapter planForFieldMask:fieldMask];
+	frame.propertyMappings = (frame.plan != nil ? frame.plan.propertyMappings : adapter.propertyMappings);
+	frame.dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:JSONDictionary.count];
+
+	return frame;
+}
+
+- (id)referencedModelFromJSONDictionary:(NSDictionary *)JSONDictionary referenceID:(id)referenceID modelsByReferenceID:(NSMutableDictionary *)modelsByReferenceID plan:(MTLJSONFieldMaskPlan *)plan error:(NSError **)error {
+	id model = [self.modelClass modelWithDictionary:nil error:error];
+	if (model == nil) return nil;
+
+	modelsByReferenceID[referenceID] = model;
+
+	for (MTLJSONPropertyMapping *mapping in (plan != nil ? plan.propertyMappings : self.propertyMappings)) {
+		BOOL success = YES;
+		id value = [self JSONValueForPropertyMapping:mapping fromJSONDictionary:JSONDictionary success:&success error:error];
+
+		if (!success) return nil;
+		if (value == nil) continue;
+
+		value = [self propertyValueForPropertyMapping:mapping fromJSONValue:value JSONDictionary:JSONDictionary nestedFieldMask:plan.nestedFieldMasksByPropertyKey[mapping.propertyKey] success:&success error:error];
+
+		if (!success) return nil;
+
+		if ([value isEqual:NSNull.null]) value = nil;
+
+		if (!MTLValidateAndSetValue(model, mapping.propertyKey, value, YES, error)) return nil;
+	}
+
+	if (plan == nil && ![model validate:error]) return nil;
+
+	if ([model isKindOfClass:MTLModel.class] && [[model class] tracksChanges]) [model checkpointChanges];
+
+	return model;
+}
+
+- (NSDictionary *)dictionaryValueFromJSONDictionary:(NSDictionary *)JSONDictionary propertyMappings:(NSArray *)propertyMappings plan:(MTLJSONFieldMaskPlan *)plan decodingOptions:(const MTLJSONAdapterDecodingOptions *)options error:(NSError **)error {
+	// References must be resolved, and models with the same primary key merged,
+	// in document order.
+	NSUInteger parallelArrayThreshold = (options != NULL && options->modelsByReferenceID == nil && options->identityMap == nil ? options->parallelArrayThreshold : 0);
+
+	NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:JSONDictionary.count];
+
+	// The transforms to run concurrently, in the order of their mappings.
+	NSMutableArray *parallelTransforms = nil;
+
+	// The error of the first property failing in the loop below. Any property
+	// transformed concurrently comes before it.
+	BOOL success = YES;
+	NSError *serialError = nil;
+
+	for (MTLJSONPropertyMapping *mapping in propertyMappings) {
+		id value = [self JSONValueForPropertyMapping:mapping fromJSONDictionary:JSONDictionary success:&success error:&serialError];
+
+		if (!success) break;
+		if (value == nil) continue;
+
+		NSSet *nestedFieldMask = plan.nestedFieldMasksByPropertyKey[mapping.propertyKey];
+
+		if (parallelArrayThreshold > 0 && mapping.transformer != nil && [value isKindOfClass:NSArray.class] && [value count] >= parallelArrayThreshold) {
+			if (parallelTransforms == nil) parallelTransforms = [NSMutableArray array];
+
+			MTLJSONParallelTransform *transform = [[MTLJSONParallelTransform alloc] init];
+			transform.mapping = mapping;
+			transform.JSONValue = value;
+			transform.nestedFieldMask = nestedFieldMask;
+			[parallelTransforms addObject:transform];
+
+			continue;
+		}
+
+		value = [self propertyValueForPropertyMapping:mapping fromJSONValue:value JSONDictionary:JSONDictionary nestedFieldMask:nestedFieldMask success:&success error:&serialError];
+
+		if (!success) break;
+
+		dictionaryValue[mapping.propertyKey] = value;
+	}
+
+	if (parallelTransforms != nil) {
+		// Arrays nested within the elements are transformed on the thread of
+		// the work item, to avoid occupying more threads of the queue.
+		MTLJSONAdapterDecodingOptions workItemOptions = *options;
+		workItemOptions.fieldMask = nil;
+		workItemOptions.parallelArrayThreshold = 0;
+
+		// The current thread performs work items as well, instead of blocking
+		// until threads of the queue have performed them all.
+		dispatch_apply(parallelTransforms.count, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t index) {
+			@autoreleasepool {
+				MTLJSONParallelTransform *transform = parallelTransforms[index];
+
+				const MTLJSONAdapterDecodingOptions *outerOptions = MTLJSONAdapterCurrentDecodingOptions();
+
+				MTLJSONAdapterDecodingOptions currentOptions = workItemOptions;
+				MTLJSONAdapterSetCurrentDecodingOptions(&currentOptions);
+
+				// An exception must not escape the work item, which would
+				// terminate the process.
+				@try {
+					BOOL transformSuccess = YES;
+					NSError *transformError = nil;
+					transform.value = [self transformedValueForPropertyMapping:transform.mapping fromJSONValue:transform.JSONValue nestedFieldMask:transform.nestedFieldMask success:&transformSuccess error:&transformError];
+					transform.success = transformSuccess;
+					transform.error = transformError;
+				} @catch (NSException *ex) {
+					transform.success = NO;
+					transform.exception = ex;
+				}
+
+				MTLJSONAdapterSetCurrentDecodingOptions(outerOptions);
+			}
+		});
+
+		for (MTLJSONParallelTransform *transform in parallelTransforms) {
+			if (transform.exception != nil) {
+				[self handleException:transform.exception parsingPropertyMapping:transform.mapping fromJSONDictionary:JSONDictionary error:error];
+				return nil;
+			}
+
+			if (!transform.success) {
+				if (error != NULL) *error = transform.error;
+				return nil;
+			}
+
+			dictionaryValue[transform.mapping.propertyKey] = transform.value;
+		}
+	}
+
+	if (!success) {
+		if (error != NULL) *error = serialError;
+		return nil;
+	}
+
+	return dictionaryValue;
+}
+
+- (id)JSONValueForPropertyMapping:(MTLJSONPropertyMapping *)mapping fromJSONDictionary:(NSDictionary *)JSONDictionary success:(BOOL *)success error:(NSError **)error {
+	id JSONKeyPaths = mapping.JSONKeyPaths;
+
+	const MTLJSONAdapterDecodingOptions *options = MTLJSONAdapterCurrentDecodingOptions();
+	MTLJSONDecodingUsage *usage = (options != NULL ? options->usage : NULL);
+
+	// Dictionaries handed to other transformers are checked by the adapters
+	// decoding them, if any.
+	BOOL checksDictionaries = (mapping.transformer == nil || mapping.conversion == MTLJSONPropertyConversionTypeCheck);
+
+	if (![JSONKeyPaths isKindOfClass:NSArray.class]) {
+		id value = [JSONDictionary mtl_valueForJSONKeyPath:JSONKeyPaths success:success error:error];
+
+		if (usage != NULL && value != nil && !MTLJSONDecodingUsageAddJSONValue(usage, value, options->depth, checksDictionaries, error)) {
+			*success = NO;
+			return nil;
+		}
+
+		return value;
+	}
+
+	NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+
+	for (NSString *keyPath in JSONKeyPaths) {
+		id value = [JSONDictionary mtl_valueForJSONKeyPath:keyPath success:success error:error];
+
+		if (!*success) return nil;
+
+		if (usage != NULL && value != nil && !MTLJSONDecodingUsageAddJSONValue(usage, value, options->depth, checksDictionaries, error)) {
+			*success = NO;
+			return nil;
+		}
+
+		if (value != nil) dictionary[keyPath] = value;
+	}
+
+	return dictionary;
+}
+
+- (id)propertyValueForPropertyMapping:(MTLJSONPropertyMapping *)mapping fromJSONValue:(id)JSONValue JSONDictionary:(NSDictionary *)JSONDictionary nestedFieldMask:(NSSet *)nestedFieldMask success:(BOOL *)success error:(NSError **)error {
+	@try {
+		return [self transformedValueForPropertyMapping:mapping fromJSONValue:JSONValue nestedFieldMask:nestedFieldMask success:success error:error];
+	} @catch (NSException *ex) {
+		[self handleException:ex parsingPropertyMapping:mapping fromJSONDictionary:JSONDictionary error:error];
+
+		*success = NO;
+		return nil;
+	}
+}
+
+- (id)transformedValueForPropertyMapping:(MTLJSONPropertyMapping *)mapping fromJSONValue:(id)JSONValue nestedFieldMask:(NSSet *)nestedFieldMask success:(BOOL *)success error:(NSError **)error {
+	if (mapping.transformer == nil) return JSONValue;
+
+	const MTLJSONAdapterDecodingOptions *outerOptions = NULL;
+	MTLJSONAdapterDecodingOptions options;
+
+	if (nestedFieldMask != nil) {
+		outerOptions = MTLJSONAdapterCurrentDecodingOptions();
+
+		options = (outerOptions != NULL ? *outerOptions : (MTLJSONAdapterDecodingOptions){ nil, nil, nil, nil, 0, NO, NULL, 0 });
+		options.fieldMask = nestedFieldMask;
+
+		MTLJSONAdapterSetCurrentDecodingOptions(&options);
+	}
+
+	@onExit {
+		if (nestedFieldMask != nil) MTLJSONAdapterSetCurrentDecodingOptions(outerOptions);
+	};
+
+	// Map NSNull -> nil for the transformer, and then back for the caller.
+	id value = JSONValue;
+	if ([value isEqual:NSNull.null]) value = nil;
+
+	value = [mapping transformedValue:value success:success error:error];
 
-			return nil;
-		}
-	}
+	if (!*success) return nil;
 
-	id model = [self.modelClass modelWithDictionary:dictionaryValue error:error];
+	return value ?: NSNull.null;
+}
+
+- (void)handleException:(NSException *)exception parsingPropertyMapping:(MTLJSONPropertyMapping *)mapping fromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error {
+	NSLog(@"*** Caught exception %@ parsing JSON key path \"%@\" from: %@", exception, mapping.JSONKeyPaths, JSONDictionary);
+
+	// Fail fast in Debug builds.
+	if (MTLIsDebugging()) {
+		@throw exception;
+	} else if (error != NULL) {
+		NSDictionary *userInfo = @{
+			NSLocalizedDescriptionKey: [NSString stringWithFormat:@"Caught exception parsing JSON key path \"%@\" for model class: %@", mapping.JSONKeyPaths, self.modelClass],
+			NSLocalizedRecoverySuggestionErrorKey: exception.description,
+			NSLocalizedFailureReasonErrorKey: exception.reason,
+			MTLJSONAdapterThrownExceptionErrorKey: exception
+		};
 
-	return [model validate:error] ? model : nil;
+		*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorExceptionThrown userInfo:userInfo];
+	}
 }
 
 + (NSDictionary *)valueTransformersForModelClass:(Class)modelClass {
@@ -423,24 +2095,55 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 }
 
 - (MTLJSONAdapter *)JSONAdapterForModelClass:(Class)modelClass error:(NSError **)error {
+	return [self JSONAdapterForModelClass:modelClass adapterClass:self.class error:error];
+}
+
+- (MTLJSONAdapter *)JSONAdapterForModelClass:(Class)modelClass adapterClass:(Class)adapterClass error:(NSError **)error {
 	NSParameterAssert(modelClass != nil);
 	NSParameterAssert([modelClass conformsToProtocol:@protocol(MTLJSONSerializing)]);
+	NSParameterAssert([adapterClass isSubclassOfClass:MTLJSONAdapter.class]);
 
 	@synchronized(self) {
-		MTLJSONAdapter *result = [self.JSONAdaptersByModelClass objectForKey:modelClass];
+		NSMapTable *adaptersByModelClass = self.JSONAdaptersByModelClass;
+
+		if (adapterClass != self.class) {
+			adaptersByModelClass = [self.JSONAdaptersByAdapterClass objectForKey:adapterClass];
+
+			if (adaptersByModelClass == nil) {
+				adaptersByModelClass = [NSMapTable strongToStrongObjectsMapTable];
+				[self.JSONAdaptersByAdapterClass setObject:adaptersByModelClass forKey:adapterClass];
+			}
+		}
+
+		MTLJSONAdapter *result = [adaptersByModelClass objectForKey:modelClass];
 
 		if (result != nil) return result;
 
-		result = [[self.class alloc] initWithModelClass:modelClass];
+		result = [[adapterClass alloc] initWithModelClass:modelClass];
 
 		if (result != nil) {
-			[self.JSONAdaptersByModelClass setObject:result forKey:modelClass];
+			[adaptersByModelClass setObject:result forKey:modelClass];
 		}
 
 		return result;
 	}
 }
 
+- (MTLJSONFieldMaskPlan *)planForFieldMask:(NSSet *)fieldMask {
+	if (fieldMask == nil) return nil;
+
+	@synchronized(self) {
+		MTLJSONFieldMaskPlan *plan = self.fieldMaskPlansByFieldMask[fieldMask];
+
+		if (plan == nil) {
+			plan = [[MTLJSONFieldMaskPlan alloc] initWithFieldMask:fieldMask propertyMappingsByPropertyKey:self.propertyMappingsByPropertyKey];
+			self.fieldMaskPlansByFieldMask[[fieldMask copy]] = plan;
+		}
+
+		return plan;
+	}
+}
+
 - (NSSet *)serializablePropertyKeys:(NSSet *)propertyKeys forModel:(id<MTLJSONSerializing>)model {
 	return propertyKeys;
 }
@@ -470,14 +2173,154 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 
 @end
 
+@implementation MTLJSONPropertyMapping
+
+- (instancetype)initWithPropertyKey:(NSString *)propertyKey JSONKeyPaths:(id)JSONKeyPaths transformer:(NSValueTransformer *)transformer omissionPolicy:(MTLJSONOmissionPolicy)omissionPolicy defaultValue:(id)defaultValue {
+	NSParameterAssert(propertyKey != nil);
+	NSParameterAssert(JSONKeyPaths != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_propertyKey = [propertyKey copy];
+	_JSONKeyPaths = [JSONKeyPaths copy];
+	_transformer = transformer;
+	_omissionPolicy = omissionPolicy;
+	_defaultValue = defaultValue;
+
+	_validatedClass = MTLValidatedClassForTransformer(transformer);
+	if (transformer != nil) {
+		_nestedModelClass = objc_getAssociatedObject(transformer, MTLNestedModelClassKey);
+		_nestedModelArrayClass = objc_getAssociatedObject(transformer, MTLNestedModelArrayClassKey);
+		_nestedAdapterClass = objc_getAssociatedObject(transformer, MTLNestedAdapterClassKey);
+	}
+
+	if (transformer != nil && transformer == [NSValueTransformer valueTransformerForName:MTLBooleanValueTransformerName]) {
+		_conversion = MTLJSONPropertyConversionBoolean;
+	} else if (_validatedClass != nil) {
+		_conversion = MTLJSONPropertyConversionTypeCheck;
+	} else {
+		_conversion = MTLJSONPropertyConversionTransformer;
+	}
+
+	_transformerHandlesErrors = [transformer respondsToSelector:@selector(transformedValue:success:error:)];
+	_allowsReverseTransformation = [transformer.class allowsReverseTransformation];
+	_transformerHandlesReverseErrors = [transformer respondsToSelector:@selector(reverseTransformedValue:success:error:)];
+
+	return self;
+}
+
+- (id)transformedValue:(id)value success:(BOOL *)success error:(NSError **)error {
+	switch (self.conversion) {
+		case MTLJSONPropertyConversionTypeCheck:
+			// Values of the wrong type fall through to the transformer, so that
+			// it can report the error.
+			if (value == nil || [value isKindOfClass:self.validatedClass]) return value;
+			break;
+
+		case MTLJSONPropertyConversionBoolean:
+			if (value == nil) return nil;
+			if ([value isKindOfClass:NSNumber.class]) return [value boolValue] ? (id)kCFBooleanTrue : (id)kCFBooleanFalse;
+			break;
+
+		case MTLJSONPropertyConversionTransformer:
+			break;
+	}
+
+	if (self.transformerHandlesErrors) {
+		return [(id<MTLTransformerErrorHandling>)self.transformer transformedValue:value success:success error:error];
+	} else {
+		return [self.transformer transformedValue:value];
+	}
+}
+
+- (id)reverseTransformedValue:(id)value success:(BOOL *)success error:(NSError **)error {
+	if (self.conversion == MTLJSONPropertyConversionBoolean) {
+		if (value == nil) return nil;
+		if ([value isKindOfClass:NSNumber.class]) return [value boolValue] ? (id)kCFBooleanTrue : (id)kCFBooleanFalse;
+	}
+
+	if (self.transformerHandlesReverseErrors) {
+		return [(id<MTLTransformerErrorHandling>)self.transformer reverseTransformedValue:value success:success error:error];
+	} else {
+		return [self.transformer reverseTransformedValue:value];
+	}
+}
+
+@end
+
+@implementation MTLJSONFieldMaskPlan
+
+- (instancetype)initWithFieldMask:(NSSet *)fieldMask propertyMappingsByPropertyKey:(NSDictionary *)propertyMappingsByPropertyKey {
+	NSParameterAssert(fieldMask != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	NSMutableSet *propertyKeys = [NSMutableSet set];
+	NSMutableSet *wholePropertyKeys = [NSMutableSet set];
+	NSMutableDictionary *nestedFieldMasksByPropertyKey = [NSMutableDictionary dictionary];
+
+	for (NSString *keyPath in fieldMask) {
+		NSAssert([keyPath isKindOfClass:NSString.class], @"Field masks must only contain key paths, got: %@", keyPath);
+
+		NSRange range = [keyPath rangeOfString:@"."];
+		NSString *propertyKey = (range.location == NSNotFound ? keyPath : [keyPath substringToIndex:range.location]);
+
+		if (propertyMappingsByPropertyKey[propertyKey] == nil) continue;
+
+		[propertyKeys addObject:propertyKey];
+
+		if (range.location == NSNotFound) {
+			[wholePropertyKeys addObject:propertyKey];
+		} else {
+			NSMutableSet *nestedFieldMask = nestedFieldMasksByPropertyKey[propertyKey];
+
+			if (nestedFieldMask == nil) {
+				nestedFieldMask = [NSMutableSet set];
+				nestedFieldMasksByPropertyKey[propertyKey] = nestedFieldMask;
+			}
+
+			[nestedFieldMask addObject:[keyPath substringFromIndex:range.location + 1]];
+		}
+	}
+
+	// Including a property as a whole overrides any of its key paths.
+	[nestedFieldMasksByPropertyKey removeObjectsForKeys:wholePropertyKeys.allObjects];
+
+	for (NSString *propertyKey in nestedFieldMasksByPropertyKey.allKeys) {
+		nestedFieldMasksByPropertyKey[propertyKey] = [nestedFieldMasksByPropertyKey[propertyKey] copy];
+	}
+
+	_propertyKeys = [propertyKeys copy];
+	_nestedFieldMasksByPropertyKey = [nestedFieldMasksByPropertyKey copy];
+	_propertyMappings = [[propertyMappingsByPropertyKey objectsForKeys:propertyKeys.allObjects notFoundMarker:NSNull.null] sortedArrayUsingDescriptors:@[
+		[NSSortDescriptor sortDescriptorWithKey:@"propertyKey" ascending:YES]
+	]];
+
+	return self;
+}
+
+@end
+
+@implementation MTLJSONDecodingFrame
+@end
+
+@implementation MTLJSONParallelTransform
+@end
+
 @implementation MTLJSONAdapter (ValueTransformers)
 
 + (NSValueTransformer<MTLTransformerErrorHandling> *)dictionaryTransformerWithModelClass:(Class)modelClass {
 	NSParameterAssert([modelClass conformsToProtocol:@protocol(MTLModel)]);
 	NSParameterAssert([modelClass conformsToProtocol:@protocol(MTLJSONSerializing)]);
 	__block MTLJSONAdapter *adapter;
+
+	// Guards the lazy creation of `adapter`, since the transformer may be used
+	// from several threads at once.
+	NSObject *adapterLock = [[NSObject alloc] init];
 	
-	return [MTLValueTransformer
+	NSValueTransformer<MTLTransformerErrorHandling> *transformer = [MTLValueTransformer
 		transformerUsingForwardBlock:^ id (id JSONDictionary, BOOL *success, NSError **error) {
 			if (JSONDictionary == nil) return nil;
 			
@@ -495,10 +2338,14 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 				return nil;
 			}
 
-			if (!adapter) {
-				adapter = [[self alloc] initWithModelClass:modelClass];
+			MTLJSONAdapter *currentAdapter;
+			@synchronized (adapterLock) {
+				if (!adapter) {
+					adapter = [[self alloc] initWithModelClass:modelClass];
+				}
+				currentAdapter = adapter;
 			}
-			id model = [adapter modelFromJSONDictionary:JSONDictionary error:error];
+			id model = [currentAdapter modelFromJSONDictionary:JSONDictionary error:error];
 			if (model == nil) {
 				*success = NO;
 			}
@@ -522,22 +2369,36 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 				return nil;
 			}
 
-			if (!adapter) {
-				adapter = [[self alloc] initWithModelClass:modelClass];
+			MTLJSONAdapter *currentAdapter;
+			@synchronized (adapterLock) {
+				if (!adapter) {
+					adapter = [[self alloc] initWithModelClass:modelClass];
+				}
+				currentAdapter = adapter;
 			}
-			NSDictionary *result = [adapter JSONDictionaryFromModel:model error:error];
+			NSDictionary *result = [currentAdapter JSONDictionaryFromModel:model error:error];
 			if (result == nil) {
 				*success = NO;
 			}
 
 			return result;
 		}];
+
+	objc_setAssociatedObject(transformer, MTLNestedModelClassKey, modelClass, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+	objc_setAssociatedObject(transformer, MTLNestedAdapterClassKey, self, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+
+	return transformer;
 }
 
 + (NSValueTransformer<MTLTransformerErrorHandling> *)arrayTransformerWithModelClass:(Class)modelClass {
+	return [self arrayTransformerWithModelClass:modelClass matchingPredicate:nil];
+}
+
++ (NSValueTransformer<MTLTransformerErrorHandling> *)arrayTransformerWithModelClass:(Class)modelClass matchingPredicate:(NSPredicate *)predicate {
 	id<MTLTransformerErrorHandling> dictionaryTransformer = [self dictionaryTransformerWithModelClass:modelClass];
+	NSPredicate *JSONPredicate = (predicate != nil ? MTLJSONPredicate(predicate) : nil);
 	
-	return [MTLValueTransformer
+	NSValueTransformer<MTLTransformerErrorHandling> *transformer = [MTLValueTransformer
 		transformerUsingForwardBlock:^ id (NSArray *dictionaries, BOOL *success, NSError **error) {
 			if (dictionaries == nil) return nil;
 			
@@ -558,7 +2419,7 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 			NSMutableArray *models = [NSMutableArray arrayWithCapacity:dictionaries.count];
 			for (id JSONDictionary in dictionaries) {
 				if (JSONDictionary == NSNull.null) {
-					[models addObject:NSNull.null];
+					if (JSONPredicate == nil || [JSONPredicate evaluateWithObject:JSONDictionary]) [models addObject:NSNull.null];
 					continue;
 				}
 				
@@ -576,6 +2437,9 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 					return nil;
 				}
 				
+				// Don't even allocate models for the elements filtered out.
+				if (JSONPredicate != nil && ![JSONPredicate evaluateWithObject:JSONDictionary]) continue;
+				
 				id model = [dictionaryTransformer transformedValue:JSONDictionary success:success error:error];
 				
 				if (*success == NO) return nil;
@@ -636,12 +2500,242 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 			
 			return dictionaries;
 		}];
+
+	// Filtered arrays are left to the transformer, since models are not
+	// created for every element.
+	if (predicate == nil) {
+		objc_setAssociatedObject(transformer, MTLNestedModelArrayClassKey, modelClass, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+		objc_setAssociatedObject(transformer, MTLNestedAdapterClassKey, self, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+	}
+
+	return transformer;
+}
+
++ (NSValueTransformer<MTLTransformerErrorHandling> *)arrayTransformerWithModelClass:(Class)modelClass keyedByPropertyKey:(NSString *)propertyKey {
+	NSParameterAssert(propertyKey != nil);
+
+	id<MTLTransformerErrorHandling> dictionaryTransformer = [self dictionaryTransformerWithModelClass:modelClass];
+
+	return [MTLValueTransformer
+		transformerUsingForwardBlock:^ id (NSArray *dictionaries, BOOL *success, NSError **error) {
+			if (dictionaries == nil) return nil;
+
+			if (![dictionaries isKindOfClass:NSArray.class]) {
+				if (error != NULL) {
+					NSDictionary *userInfo = @{
+						NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert JSON array to keyed models", @""),
+						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSArray, got: %@.", @""), dictionaries],
+						MTLTransformerErrorHandlingInputValueErrorKey : dictionaries
+					};
+
+					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+				}
+				*success = NO;
+				return nil;
+			}
+
+			NSMutableDictionary *modelsByKey = [NSMutableDictionary dictionaryWithCapacity:dictionaries.count];
+			for (id JSONDictionary in dictionaries) {
+				if (JSONDictionary == NSNull.null) continue;
+
+				if (![JSONDictionary isKindOfClass:NSDictionary.class]) {
+					if (error != NULL) {
+						NSDictionary *userInfo = @{
+							NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert JSON array to keyed models", @""),
+							NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSDictionary or an NSNull, got: %@.", @""), JSONDictionary],
+							MTLTransformerErrorHandlingInputValueErrorKey : JSONDictionary
+						};
+
+						*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+					}
+					*success = NO;
+					return nil;
+				}
+
+				id model = [dictionaryTransformer transformedValue:JSONDictionary success:success error:error];
+
+				if (*success == NO) return nil;
+
+				if (model == nil) continue;
+
+				id key = [model valueForKey:propertyKey];
+				if (key == nil || key == NSNull.null) {
+					if (error != NULL) {
+						NSDictionary *userInfo = @{
+							NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert JSON array to keyed models", @""),
+							NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Model %@ has no value for key \"%@\".", @""), model, propertyKey],
+							MTLTransformerErrorHandlingInputValueErrorKey : JSONDictionary
+						};
+
+						*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+					}
+					*success = NO;
+					return nil;
+				}
+
+				if (modelsByKey[key] != nil) {
+					if (error != NULL) {
+						NSDictionary *userInfo = @{
+							NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert JSON array to keyed models", @""),
+							NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"More than one model has the value %@ for key \"%@\".", @""), key, propertyKey],
+							MTLTransformerErrorHandlingInputValueErrorKey : JSONDictionary
+						};
+
+						*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+					}
+					*success = NO;
+					return nil;
+				}
+
+				modelsByKey[key] = model;
+			}
+
+			return modelsByKey;
+		}
+		reverseBlock:^ id (NSDictionary *modelsByKey, BOOL *success, NSError **error) {
+			if (modelsByKey == nil) return nil;
+
+			if (![modelsByKey isKindOfClass:NSDictionary.class]) {
+				if (error != NULL) {
+					NSDictionary *userInfo = @{
+						NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert keyed models to JSON array", @""),
+						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSDictionary, got: %@.", @""), modelsByKey],
+						MTLTransformerErrorHandlingInputValueErrorKey : modelsByKey
+					};
+
+					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+				}
+				*success = NO;
+				return nil;
+			}
+
+			NSArray *keys = [modelsByKey.allKeys sortedArrayUsingComparator:^(id key, id otherKey) {
+				return MTLJSONCompareModelKeys(key, otherKey);
+			}];
+
+			NSMutableArray *dictionaries = [NSMutableArray arrayWithCapacity:modelsByKey.count];
+			for (id key in keys) {
+				NSDictionary *dict = [dictionaryTransformer reverseTransformedValue:modelsByKey[key] success:success error:error];
+
+				if (*success == NO) return nil;
+
+				if (dict == nil) continue;
+
+				[dictionaries addObject:dict];
+			}
+
+			return dictionaries;
+		}];
+}
+
++ (NSValueTransformer<MTLTransformerErrorHandling> *)keyedDictionaryTransformerWithModelClass:(Class)modelClass {
+	id<MTLTransformerErrorHandling> dictionaryTransformer = [self dictionaryTransformerWithModelClass:modelClass];
+
+	return [MTLValueTransformer
+		transformerUsingForwardBlock:^ id (NSDictionary *JSONDictionaries, BOOL *success, NSError **error) {
+			if (JSONDictionaries == nil) return nil;
+
+			if (![JSONDictionaries isKindOfClass:NSDictionary.class]) {
+				if (error != NULL) {
+					NSDictionary *userInfo = @{
+						NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert JSON dictionary to keyed models", @""),
+						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSDictionary, got: %@.", @""), JSONDictionaries],
+						MTLTransformerErrorHandlingInputValueErrorKey : JSONDictionaries
+					};
+
+					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+				}
+				*success = NO;
+				return nil;
+			}
+
+			NSMutableDictionary *modelsByKey = [NSMutableDictionary dictionaryWithCapacity:JSONDictionaries.count];
+			for (id key in JSONDictionaries) {
+				id JSONDictionary = JSONDictionaries[key];
+
+				if (JSONDictionary == NSNull.null) {
+					modelsByKey[key] = NSNull.null;
+					continue;
+				}
+
+				if (![JSONDictionary isKindOfClass:NSDictionary.class]) {
+					if (error != NULL) {
+						NSDictionary *userInfo = @{
+							NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert JSON dictionary to keyed models", @""),
+							NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSDictionary or an NSNull, got: %@.", @""), JSONDictionary],
+							MTLTransformerErrorHandlingInputValueErrorKey : JSONDictionary
+						};
+
+						*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+					}
+					*success = NO;
+					return nil;
+				}
+
+				id model = [dictionaryTransformer transformedValue:JSONDictionary success:success error:error];
+
+				if (*success == NO) return nil;
+
+				if (model == nil) continue;
+
+				modelsByKey[key] = model;
+			}
+
+			return modelsByKey;
+		}
+		reverseBlock:^ id (NSDictionary *modelsByKey, BOOL *success, NSError **error) {
+			if (modelsByKey == nil) return nil;
+
+			if (![modelsByKey isKindOfClass:NSDictionary.class]) {
+				if (error != NULL) {
+					NSDictionary *userInfo = @{
+						NSLocalizedDescriptionKey: NSLocalizedString(@"Could not convert keyed models to JSON dictionary", @""),
+						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSDictionary, got: %@.", @""), modelsByKey],
+						MTLTransformerErrorHandlingInputValueErrorKey : modelsByKey
+					};
+
+					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+				}
+				*success = NO;
+				return nil;
+			}
+
+			// The result has no order, but the first model to fail should be the
+			// same every time.
+			NSArray *keys = [modelsByKey.allKeys sortedArrayUsingComparator:^(id key, id otherKey) {
+				return MTLJSONCompareModelKeys(key, otherKey);
+			}];
+
+			NSMutableDictionary *JSONDictionaries = [NSMutableDictionary dictionaryWithCapacity:modelsByKey.count];
+			for (id key in keys) {
+				id model = modelsByKey[key];
+
+				if (model == NSNull.null) {
+					JSONDictionaries[key] = NSNull.null;
+					continue;
+				}
+
+				NSDictionary *dict = [dictionaryTransformer reverseTransformedValue:model success:success error:error];
+
+				if (*success == NO) return nil;
+
+				if (dict == nil) continue;
+
+				JSONDictionaries[key] = dict;
+			}
+
+			return JSONDictionaries;
+		}];
 }
 
 + (NSValueTransformer *)NSURLJSONTransformer {
 	return [NSValueTransformer valueTransformerForName:MTLURLValueTransformerName];
 }
 
++ (NSValueTransformer *)NSUUIDJSONTransformer {
+	return [NSValueTransformer valueTransformerForName:MTLUUIDValueTransformerName];
+}
+
 @end
 
 @implementation MTLJSONAdapter (Deprecated)
@@ -0,0 +1,46 @@
+//
+//  MTLJSONDecodingLimits.h
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Bounds the resources an MTLJSONAdapter may spend decoding a single model,
+/// so that pathological JSON from untrusted sources fails quickly instead of
+/// being decoded to completion.
+///
+/// An MTLJSONAdapter whose `limits` are set checks them while decoding, and
+/// fails with MTLJSONAdapterErrorLimitExceeded as soon as one is exceeded. The
+/// limits apply to the whole graph decoded by one call, including the models
+/// decoded by the adapters of nested transformers.
+///
+/// Every limit is NSUIntegerMax, which means unlimited, by default.
+@interface MTLJSONDecodingLimits : NSObject <NSCopying>
+
+/// The number of models and JSON containers which may be nested in each
+/// other, counting the outermost model as 1.
+///
+/// Each nested model counts as one level, as does each JSON array or
+/// dictionary within the JSON value of a property.
+@property (nonatomic, assign) NSUInteger maximumDepth;
+
+/// The total number of elements in all JSON arrays.
+@property (nonatomic, assign) NSUInteger maximumElementCount;
+
+/// The number of elements in any single JSON array.
+@property (nonatomic, assign) NSUInteger maximumArrayLength;
+
+/// The length of any single JSON string, in bytes of UTF-8.
+@property (nonatomic, assign) NSUInteger maximumStringLength;
+
+/// The total number of models created.
+@property (nonatomic, assign) NSUInteger maximumModelCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,47 @@
+//
+//  MTLJSONDecodingLimits.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLJSONDecodingLimits.h"
+
+@implementation MTLJSONDecodingLimits
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_maximumDepth = NSUIntegerMax;
+	_maximumElementCount = NSUIntegerMax;
+	_maximumArrayLength = NSUIntegerMax;
+	_maximumStringLength = NSUIntegerMax;
+	_maximumModelCount = NSUIntegerMax;
+
+	return self;
+}
+
+#pragma mark NSCopying
+
+- (id)copyWithZone:(NSZone *)zone {
+	MTLJSONDecodingLimits *limits = [[self.class allocWithZone:zone] init];
+	limits.maximumDepth = self.maximumDepth;
+	limits.maximumElementCount = self.maximumElementCount;
+	limits.maximumArrayLength = self.maximumArrayLength;
+	limits.maximumStringLength = self.maximumStringLength;
+	limits.maximumModelCount = self.maximumModelCount;
+
+	return limits;
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> maximumDepth: %lu, maximumElementCount: %lu, maximumArrayLength: %lu, maximumStringLength: %lu, maximumModelCount: %lu", self.class, self, (unsigned long)self.maximumDepth, (unsigned long)self.maximumElementCount, (unsigned long)self.maximumArrayLength, (unsigned long)self.maximumStringLength, (unsigned long)self.maximumModelCount];
+}
+
+@end
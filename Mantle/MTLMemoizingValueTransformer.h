@@ -0,0 +1,68 @@
+//
+//  MTLMemoizingValueTransformer.h
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "MTLTransformerErrorHandling.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A value transformer which remembers the results of another transformer.
+///
+/// Forward and reverse results are kept in separate caches keyed by the input
+/// value, each holding at most `countLimit` results. When a cache is full, the
+/// least recently used result is discarded. Lookups may happen concurrently
+/// from multiple threads.
+///
+/// Only successful transformations of inputs conforming to <NSCopying> are
+/// remembered. Since cached results are shared between all callers, the
+/// wrapped transformer should return immutable objects.
+///
+/// Memoization is opted into per property by returning a memoizing transformer
+/// from `+<key>JSONTransformer`. Because adapters ask for their transformers
+/// whenever they are created, the same instance should be returned every time
+/// for the cache to be effective:
+///
+///     + (NSValueTransformer *)URLJSONTransformer {
+///         static MTLMemoizingValueTransformer *transformer;
+///         static dispatch_once_t onceToken;
+///         dispatch_once(&onceToken, ^{
+///             NSValueTransformer *URLTransformer = [NSValueTransformer valueTransformerForName:MTLURLValueTransformerName];
+///             transformer = [MTLMemoizingValueTransformer transformerWithTransformer:URLTransformer countLimit:1024];
+///         });
+///
+///         return transformer;
+///     }
+@interface MTLMemoizingValueTransformer : NSValueTransformer <MTLTransformerErrorHandling>
+
+/// Returns a transformer which remembers the results of `transformer`.
+///
+/// transformer - The transformer whose results should be remembered. If the
+///               transformer is reversible, the transformer returned by this
+///               method will be reversible. This argument must not be nil.
+/// countLimit  - The maximum number of results to remember in each direction.
+///               This argument must be greater than zero.
++ (instancetype)transformerWithTransformer:(NSValueTransformer *)transformer countLimit:(NSUInteger)countLimit;
+
+/// The transformer whose results are being remembered.
+@property (nonatomic, strong, readonly) NSValueTransformer *transformer;
+
+/// The maximum number of results remembered in each direction.
+@property (nonatomic, assign, readonly) NSUInteger countLimit;
+
+/// The number of transformations that were answered from the caches.
+@property (atomic, assign, readonly) NSUInteger hitCount;
+
+/// The number of transformations that had to invoke `transformer`.
+@property (atomic, assign, readonly) NSUInteger missCount;
+
+/// Forgets all remembered results. Does not reset `hitCount` or `missCount`.
+- (void)removeAllCachedValues;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,376 @@
+//
+//  MTLMemoizingValueTransformer.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <pthread.h>
+
+#import "MTLMemoizingValueTransformer.h"
+
+// The number of independently locked shards each cache is split into, so that
+// concurrent lookups of different values rarely contend.
+static const NSUInteger MTLMemoizingCacheMaximumShardCount = 8;
+
+// Stands in for nil results in the caches.
+static id MTLMemoizingCacheNilValue(void) {
+	static id nilValue;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		nilValue = [[NSObject alloc] init];
+	});
+
+	return nilValue;
+}
+
+// A cached result, linked into its shard's recency list.
+@interface MTLMemoizingCacheEntry : NSObject
+
+@property (nonatomic, strong) id key;
+@property (nonatomic, strong) id value;
+
+// Entries are owned by the dictionary of their shard, so the list itself does
+// not retain them.
+@property (nonatomic, unsafe_unretained) MTLMemoizingCacheEntry *previous;
+@property (nonatomic, unsafe_unretained) MTLMemoizingCacheEntry *next;
+
+@end
+
+// A bounded LRU cache protected by its own lock.
+@interface MTLMemoizingCacheShard : NSObject {
+	pthread_mutex_t _lock;
+}
+
+@property (nonatomic, assign, readonly) NSUInteger countLimit;
+@property (nonatomic, strong, readonly) NSMutableDictionary *entriesByKey;
+
+// The most and least recently used entries.
+@property (nonatomic, unsafe_unretained) MTLMemoizingCacheEntry *head;
+@property (nonatomic, unsafe_unretained) MTLMemoizingCacheEntry *tail;
+
+// Only accessed while holding the lock.
+@property (nonatomic, assign) NSUInteger hitCount;
+@property (nonatomic, assign) NSUInteger missCount;
+
+- (instancetype)initWithCountLimit:(NSUInteger)countLimit;
+
+// Adds the number of hits and misses of the receiver to the given counts.
+- (void)addHitCount:(NSUInteger *)hitCount missCount:(NSUInteger *)missCount;
+
+// Looks up the value for `key`, marking it as most recently used.
+//
+// Returns the cached value, MTLMemoizingCacheNilValue() for a cached nil, or
+// nil if nothing is cached for `key`.
+- (id)objectForKey:(id)key;
+
+// Caches `object` for `key`, evicting the least recently used entry if the
+// shard is full.
+- (void)setObject:(id)object forKey:(id<NSCopying>)key;
+
+- (void)removeAllObjects;
+
+@end
+
+@interface MTLMemoizingValueTransformer ()
+
+@property (nonatomic, copy, readonly) NSArray *forwardShards;
+@property (nonatomic, copy, readonly) NSArray *reverseShards;
+
+// Whether `transformer` implements <MTLTransformerErrorHandling>.
+@property (nonatomic, assign, readonly) BOOL transformerHandlesErrors;
+
+- (instancetype)initWithTransformer:(NSValueTransformer *)transformer countLimit:(NSUInteger)countLimit;
+
+// Returns the result for `value` from `shards`, or invokes `transformation` and
+// remembers its result if it succeeds.
+- (id)valueForValue:(id)value inShards:(NSArray *)shards success:(BOOL *)success error:(NSError **)error usingTransformation:(id (^)(id value, BOOL *success, NSError **error))transformation;
+
+@end
+
+// Any MTLMemoizingValueTransformer wrapping a reversible transformer. Necessary
+// because +allowsReverseTransformation is a class method.
+@interface MTLReversibleMemoizingValueTransformer : MTLMemoizingValueTransformer
+@end
+
+@implementation MTLMemoizingValueTransformer
+
+#pragma mark Lifecycle
+
++ (instancetype)transformerWithTransformer:(NSValueTransformer *)transformer countLimit:(NSUInteger)countLimit {
+	Class class = transformer.class.allowsReverseTransformation ? MTLReversibleMemoizingValueTransformer.class : MTLMemoizingValueTransformer.class;
+
+	return [[class alloc] initWithTransformer:transformer countLimit:countLimit];
+}
+
+- (instancetype)initWithTransformer:(NSValueTransformer *)transformer countLimit:(NSUInteger)countLimit {
+	NSParameterAssert(transformer != nil);
+	NSParameterAssert(countLimit > 0);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_transformer = transformer;
+	_countLimit = countLimit;
+	_transformerHandlesErrors = [transformer conformsToProtocol:@protocol(MTLTransformerErrorHandling)];
+
+	NSUInteger shardCount = MIN(countLimit, MTLMemoizingCacheMaximumShardCount);
+
+	// Split the limit exactly, giving the remainder to the first shards.
+	NSMutableArray *forwardShards = [NSMutableArray arrayWithCapacity:shardCount];
+	NSMutableArray *reverseShards = [NSMutableArray arrayWithCapacity:shardCount];
+	for (NSUInteger i = 0; i < shardCount; i++) {
+		NSUInteger shardCountLimit = countLimit / shardCount + (i < countLimit % shardCount ? 1 : 0);
+
+		[forwardShards addObject:[[MTLMemoizingCacheShard alloc] initWithCountLimit:shardCountLimit]];
+		[reverseShards addObject:[[MTLMemoizingCacheShard alloc] initWithCountLimit:shardCountLimit]];
+	}
+
+	_forwardShards = [forwardShards copy];
+	_reverseShards = [reverseShards copy];
+
+	return self;
+}
+
+#pragma mark Statistics
+
+- (NSUInteger)hitCount {
+	NSUInteger hitCount = 0;
+	NSUInteger missCount = 0;
+	for (MTLMemoizingCacheShard *shard in [self.forwardShards arrayByAddingObjectsFromArray:self.reverseShards]) {
+		[shard addHitCount:&hitCount missCount:&missCount];
+	}
+
+	return hitCount;
+}
+
+- (NSUInteger)missCount {
+	NSUInteger hitCount = 0;
+	NSUInteger missCount = 0;
+	for (MTLMemoizingCacheShard *shard in [self.forwardShards arrayByAddingObjectsFromArray:self.reverseShards]) {
+		[shard addHitCount:&hitCount missCount:&missCount];
+	}
+
+	return missCount;
+}
+
+- (void)removeAllCachedValues {
+	for (MTLMemoizingCacheShard *shard in [self.forwardShards arrayByAddingObjectsFromArray:self.reverseShards]) {
+		[shard removeAllObjects];
+	}
+}
+
+#pragma mark Caching
+
+- (id)valueForValue:(id)value inShards:(NSArray *)shards success:(BOOL *)success error:(NSError **)error usingTransformation:(id (^)(id, BOOL *, NSError **))transformation {
+	BOOL transformationSuccess = YES;
+
+	if (value == nil || ![value conformsToProtocol:@protocol(NSCopying)]) {
+		id result = transformation(value, &transformationSuccess, error);
+		if (success != NULL) *success = transformationSuccess;
+
+		return result;
+	}
+
+	// Scramble the hash, since the low bits of many -hash implementations are
+	// poorly distributed.
+	unsigned long long scrambledHash = (unsigned long long)[value hash] * 0x9E3779B97F4A7C15ULL;
+	MTLMemoizingCacheShard *shard = shards[(NSUInteger)(scrambledHash >> 32) % shards.count];
+
+	id cachedResult = [shard objectForKey:value];
+	if (cachedResult != nil) {
+		if (success != NULL) *success = YES;
+
+		return cachedResult == MTLMemoizingCacheNilValue() ? nil : cachedResult;
+	}
+
+	id result = transformation(value, &transformationSuccess, error);
+	if (success != NULL) *success = transformationSuccess;
+
+	if (transformationSuccess) {
+		[shard setObject:result ?: MTLMemoizingCacheNilValue() forKey:value];
+	}
+
+	return result;
+}
+
+#pragma mark NSValueTransformer
+
++ (BOOL)allowsReverseTransformation {
+	return NO;
+}
+
++ (Class)transformedValueClass {
+	return NSObject.class;
+}
+
+- (id)transformedValue:(id)value {
+	return [self transformedValue:value success:NULL error:NULL];
+}
+
+#pragma mark MTLTransformerErrorHandling
+
+- (id)transformedValue:(id)value success:(BOOL *)success error:(NSError **)error {
+	NSValueTransformer *transformer = self.transformer;
+	BOOL handlesErrors = self.transformerHandlesErrors;
+
+	return [self valueForValue:value inShards:self.forwardShards success:success error:error usingTransformation:^(id input, BOOL *transformationSuccess, NSError **transformationError) {
+		if (handlesErrors) {
+			return [(id<MTLTransformerErrorHandling>)transformer transformedValue:input success:transformationSuccess error:transformationError];
+		} else {
+			return [transformer transformedValue:input];
+		}
+	}];
+}
+
+@end
+
+@implementation MTLReversibleMemoizingValueTransformer
+
+#pragma mark NSValueTransformer
+
++ (BOOL)allowsReverseTransformation {
+	return YES;
+}
+
+- (id)reverseTransformedValue:(id)value {
+	return [self reverseTransformedValue:value success:NULL error:NULL];
+}
+
+#pragma mark MTLTransformerErrorHandling
+
+- (id)reverseTransformedValue:(id)value success:(BOOL *)success error:(NSError **)error {
+	NSValueTransformer *transformer = self.transformer;
+	BOOL handlesErrors = self.transformerHandlesErrors && [transformer respondsToSelector:@selector(reverseTransformedValue:success:error:)];
+
+	return [self valueForValue:value inShards:self.reverseShards success:success error:error usingTransformation:^(id input, BOOL *transformationSuccess, NSError **transformationError) {
+		if (handlesErrors) {
+			return [(id<MTLTransformerErrorHandling>)transformer reverseTransformedValue:input success:transformationSuccess error:transformationError];
+		} else {
+			return [transformer reverseTransformedValue:input];
+		}
+	}];
+}
+
+@end
+
+@implementation MTLMemoizingCacheEntry
+@end
+
+@implementation MTLMemoizingCacheShard
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithCountLimit:(NSUInteger)countLimit {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_countLimit = countLimit;
+	_entriesByKey = [[NSMutableDictionary alloc] initWithCapacity:countLimit];
+	pthread_mutex_init(&_lock, NULL);
+
+	return self;
+}
+
+- (void)dealloc {
+	pthread_mutex_destroy(&_lock);
+}
+
+#pragma mark Recency
+
+- (void)unlinkEntry:(MTLMemoizingCacheEntry *)entry {
+	if (entry.previous != nil) {
+		entry.previous.next = entry.next;
+	} else {
+		self.head = entry.next;
+	}
+
+	if (entry.next != nil) {
+		entry.next.previous = entry.previous;
+	} else {
+		self.tail = entry.previous;
+	}
+
+	entry.previous = nil;
+	entry.next = nil;
+}
+
+- (void)linkEntryAtHead:(MTLMemoizingCacheEntry *)entry {
+	entry.next = self.head;
+	if (self.head != nil) self.head.previous = entry;
+
+	self.head = entry;
+	if (self.tail == nil) self.tail = entry;
+}
+
+#pragma mark Access
+
+- (id)objectForKey:(id)key {
+	pthread_mutex_lock(&_lock);
+
+	MTLMemoizingCacheEntry *entry = self.entriesByKey[key];
+	id value = entry.value;
+
+	if (entry != nil) {
+		if (entry != self.head) {
+			[self unlinkEntry:entry];
+			[self linkEntryAtHead:entry];
+		}
+
+		self.hitCount++;
+	} else {
+		self.missCount++;
+	}
+
+	pthread_mutex_unlock(&_lock);
+
+	return value;
+}
+
+- (void)setObject:(id)object forKey:(id<NSCopying>)key {
+	pthread_mutex_lock(&_lock);
+
+	MTLMemoizingCacheEntry *entry = self.entriesByKey[key];
+	if (entry != nil) {
+		// Another thread transformed the same value in the meantime.
+		entry.value = object;
+		[self unlinkEntry:entry];
+	} else {
+		entry = [[MTLMemoizingCacheEntry alloc] init];
+		entry.key = [key copyWithZone:NULL];
+		entry.value = object;
+		self.entriesByKey[entry.key] = entry;
+	}
+
+	[self linkEntryAtHead:entry];
+
+	if (self.entriesByKey.count > self.countLimit) {
+		MTLMemoizingCacheEntry *leastRecentlyUsed = self.tail;
+		[self unlinkEntry:leastRecentlyUsed];
+		[self.entriesByKey removeObjectForKey:leastRecentlyUsed.key];
+	}
+
+	pthread_mutex_unlock(&_lock);
+}
+
+- (void)addHitCount:(NSUInteger *)hitCount missCount:(NSUInteger *)missCount {
+	pthread_mutex_lock(&_lock);
+
+	*hitCount += self.hitCount;
+	*missCount += self.missCount;
+
+	pthread_mutex_unlock(&_lock);
+}
+
+- (void)removeAllObjects {
+	pthread_mutex_lock(&_lock);
+
+	self.head = nil;
+	self.tail = nil;
+	[self.entriesByKey removeAllObjects];
+
+	pthread_mutex_unlock(&_lock);
+}
+
+@end
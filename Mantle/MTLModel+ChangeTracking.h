@@ -0,0 +1,54 @@
+//
+//  MTLModel+ChangeTracking.h
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLModel.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Keeps track of the properties of a model which changed since a checkpoint.
+@interface MTLModel (ChangeTracking)
+
+/// Whether instances of the receiver record a checkpoint when they are decoded.
+///
+/// Subclasses can override this method to return YES to have MTLJSONAdapter
+/// call -checkpointChanges on every instance it decodes, so that
+/// -changedKeyPaths reports what changed since the model was decoded.
+///
+/// The default implementation returns NO.
++ (BOOL)tracksChanges;
+
+/// Records the current values of the receiver's properties, so that
+/// -changedKeyPaths only reports the properties which change from now on.
+///
+/// Nested models are checkpointed as well. The property graph must not contain
+/// cycles.
+- (void)checkpointChanges;
+
+/// The key paths of the properties which changed since the last call to
+/// -checkpointChanges, in order of their keys.
+///
+/// Only properties for which +storageBehaviorForPropertyWithKey: returns
+/// MTLPropertyStoragePermanent are tracked. A property changed if it holds a
+/// different model than at the checkpoint, or a value which is not equal to
+/// the one at the checkpoint. If it still holds the same mutable model, the
+/// changes of that model are reported instead, prefixed by the key of the
+/// property, like `owner.name`. Collections are copied when checkpointed and
+/// compared as a whole, so mutating a mutable collection in place is reported
+/// as a change of its property, but changing a model inside of an array is not
+/// detected.
+///
+/// If the receiver has never been checkpointed, all of its properties are
+/// reported.
+@property (nonatomic, copy, readonly) NSArray<NSString *> *changedKeyPaths;
+
+/// Whether -changedKeyPaths is not empty.
+@property (nonatomic, assign, readonly) BOOL hasChanges;
+
+@end
+
+NS_ASSUME_NONNULL_END
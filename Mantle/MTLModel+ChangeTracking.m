@@ -0,0 +1,106 @@
+//
+//  MTLModel+ChangeTracking.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <objc/runtime.h>
+
+#import "MTLModel+ChangeTracking.h"
+#import "MTLModel_Private.h"
+
+// Associated in -checkpointChanges with an array of the values of all
+// +permanentPropertyAccessors, with NSNull in place of nil.
+static void *MTLModelChangeCheckpointKey = &MTLModelChangeCheckpointKey;
+
+// Returns whether changes of `value` are tracked as part of the model holding
+// it, rather than by replacing it.
+static BOOL MTLModelTracksNestedChanges(id value) {
+	return [value isKindOfClass:MTLModel.class] && ![[value class] isImmutable];
+}
+
+// Returns the value to keep in the checkpoint for `value`.
+//
+// Values with a mutable variant, like collections, are copied, so that changes
+// made to a mutable instance in place don't change its checkpoint as well.
+// Copying an immutable instance usually returns the instance itself.
+static id MTLModelCheckpointValue(id value) {
+	if (![value conformsToProtocol:@protocol(NSMutableCopying)] || ![value conformsToProtocol:@protocol(NSCopying)]) return value;
+
+	return [value copy];
+}
+
+// Appends the key paths of the properties of `model` which changed since its
+// checkpoint, prefixed by `prefix` if it isn't nil, to `keyPaths`.
+//
+// Returns whether any key path was appended. If `keyPaths` is nil, stops at the
+// first change.
+static BOOL MTLModelAppendChangedKeyPaths(MTLModel *model, NSString *prefix, NSMutableArray *keyPaths) {
+	NSArray *accessors = [model.class permanentPropertyAccessors];
+	NSArray *checkpoint = objc_getAssociatedObject(model, MTLModelChangeCheckpointKey);
+
+	__block BOOL changed = NO;
+
+	[accessors enumerateObjectsUsingBlock:^(MTLModelPropertyAccessor *accessor, NSUInteger index, BOOL *stop) {
+		id value = [accessor valueForModel:model] ?: NSNull.null;
+		id checkpointValue = checkpoint[index];
+
+		NSString *keyPath = (prefix != nil ? [NSString stringWithFormat:@"%@.%@", prefix, accessor.key] : accessor.key);
+
+		if (checkpointValue == value) {
+			if (!MTLModelTracksNestedChanges(value)) return;
+
+			if (MTLModelAppendChangedKeyPaths(value, keyPath, keyPaths)) {
+				changed = YES;
+				if (keyPaths == nil) *stop = YES;
+			}
+
+			return;
+		}
+
+		// Models are only replaced by different ones, and comparing them in
+		// full would cost as much as tracking their changes.
+		if (checkpointValue != nil && !MTLModelTracksNestedChanges(value) && [value isEqual:checkpointValue]) return;
+
+		changed = YES;
+		[keyPaths addObject:keyPath];
+		if (keyPaths == nil) *stop = YES;
+	}];
+
+	return changed;
+}
+
+@implementation MTLModel (ChangeTracking)
+
++ (BOOL)tracksChanges {
+	return NO;
+}
+
+- (void)checkpointChanges {
+	NSArray *accessors = self.class.permanentPropertyAccessors;
+	NSMutableArray *values = [NSMutableArray arrayWithCapacity:accessors.count];
+
+	for (MTLModelPropertyAccessor *accessor in accessors) {
+		id value = [accessor valueForModel:self] ?: NSNull.null;
+		if (MTLModelTracksNestedChanges(value)) [value checkpointChanges];
+
+		[values addObject:MTLModelCheckpointValue(value)];
+	}
+
+	objc_setAssociatedObject(self, MTLModelChangeCheckpointKey, values, OBJC_ASSOCIATION_COPY);
+}
+
+- (NSArray *)changedKeyPaths {
+	NSMutableArray *keyPaths = [NSMutableArray array];
+	MTLModelAppendChangedKeyPaths(self, nil, keyPaths);
+
+	return keyPaths;
+}
+
+- (BOOL)hasChanges {
+	return MTLModelAppendChangedKeyPaths(self, nil, nil);
+}
+
+@end
@@ -0,0 +1,43 @@
+//
+//  MTLModel+Diffing.h
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLModel.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Finds the differences between two versions of a model.
+@interface MTLModel (Diffing)
+
+/// Returns the key paths of the properties whose values differ between `model`
+/// and the receiver.
+///
+/// Only properties for which +storageBehaviorForPropertyWithKey: returns
+/// MTLPropertyStoragePermanent are compared. If both values of a property are
+/// models of the same class, they are compared recursively, and the key paths
+/// of their changed properties are returned prefixed by the key of the
+/// property, like `owner.name`. Any other value which differs is returned as
+/// the key of its property.
+///
+/// Values are only visited as far as needed: identical objects are skipped
+/// without looking at them, and so are immutable models whose cached hashes
+/// match, as long as they turn out to be equal. Any other nested models are
+/// descended into without comparing them as a whole first, so that the key
+/// paths of their changed properties can be returned.
+///
+/// model - The previous version of the receiver. This must be an instance of
+///         the receiver's class, and must not be nil.
+///
+/// The property graph must not contain cycles.
+///
+/// Returns the changed key paths in order of their keys, or an empty array if
+/// the models are equal.
+- (NSArray<NSString *> *)changedKeyPathsFromModel:(MTLModel *)model;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,52 @@
+//
+//  MTLModel+Diffing.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLModel+Diffing.h"
+#import "MTLModel_Private.h"
+
+// Appends the key paths of the properties which differ between `oldModel` and
+// `newModel`, which must be instances of the same class, to `keyPaths`.
+static void MTLModelAppendChangedKeyPaths(MTLModel *oldModel, MTLModel *newModel, NSString *prefix, NSMutableArray *keyPaths) {
+	for (MTLModelPropertyAccessor *accessor in [newModel.class permanentPropertyAccessors]) {
+		NSString *keyPath = (prefix != nil ? [NSString stringWithFormat:@"%@.%@", prefix, accessor.key] : accessor.key);
+
+		id oldValue = [accessor valueForModel:oldModel];
+		id newValue = [accessor valueForModel:newModel];
+
+		if (oldValue == newValue) continue;
+
+		if ([oldValue isKindOfClass:MTLModel.class] && [newValue isMemberOfClass:[oldValue class]]) {
+			NSUInteger oldHash = [oldValue cachedHash];
+			NSUInteger newHash = [newValue cachedHash];
+
+			// Equal hashes don't prove equality, but make it likely enough to
+			// check it before descending into the models.
+			if (oldHash != 0 && oldHash == newHash && [oldValue isEqual:newValue]) continue;
+
+			MTLModelAppendChangedKeyPaths(oldValue, newValue, keyPath, keyPaths);
+			continue;
+		}
+
+		if (![accessor isValueOfModel:oldModel equalToValueOfModel:newModel]) [keyPaths addObject:keyPath];
+	}
+}
+
+@implementation MTLModel (Diffing)
+
+- (NSArray *)changedKeyPathsFromModel:(MTLModel *)model {
+	NSParameterAssert([model isMemberOfClass:self.class]);
+
+	NSMutableArray *keyPaths = [NSMutableArray array];
+	if (model == self) return keyPaths;
+
+	MTLModelAppendChangedKeyPaths(model, self, nil, keyPaths);
+
+	return keyPaths;
+}
+
+@end
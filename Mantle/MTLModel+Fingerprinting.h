@@ -0,0 +1,49 @@
+//
+//  MTLModel+Fingerprinting.h
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLModel.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The number of bytes in a fingerprint returned by -contentFingerprint.
+extern const NSUInteger MTLModelFingerprintLength;
+
+/// Computes digests of the contents of MTLModel objects.
+@interface MTLModel (Fingerprinting)
+
+/// A 128-bit digest of the receiver's contents, which is the same in every
+/// process and on every machine.
+///
+/// Unlike -hash, which is only meaningful within a single process, this is
+/// suitable for keying caches and deduplicating models that are stored or
+/// sent elsewhere.
+///
+/// The digest covers the class name of the receiver and the values of all
+/// properties for which +storageBehaviorForPropertyWithKey: returns
+/// MTLPropertyStoragePermanent, in order of their keys. Values are encoded
+/// canonically: nested models contribute their own fingerprint, arrays their
+/// elements in order, and dictionaries and sets their contents regardless of
+/// order. Numbers which compare equal, like `@1` and `@1.0`, are encoded the
+/// same. Strings, data, dates, URLs and UUIDs are encoded by value, and
+/// NSValues field by field, ignoring any padding.
+///
+/// Any other object, or an NSValue holding anything but numbers and BOOLs, like
+/// a pointer, cannot be encoded by value and raises an
+/// NSInvalidArgumentException.
+///
+/// The fingerprint of a model whose class returns YES from +isImmutable, and
+/// whose values are all immutable as described there, is computed only once,
+/// so fingerprinting a graph of immutable models visits each of them a single
+/// time.
+///
+/// The property graph must not contain cycles.
+@property (nonatomic, copy, readonly) NSData *contentFingerprint;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,357 @@
+//
+//  MTLModel+Fingerprinting.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <CommonCrypto/CommonDigest.h>
+#import <math.h>
+
+#import <Mantle/EXTScope.h>
+
+#import "MTLModel+Fingerprinting.h"
+#import "MTLModel_Private.h"
+
+const NSUInteger MTLModelFingerprintLength = 16;
+
+// Identifies the encoding hashed into fingerprints, so that fingerprints from
+// different versions of the encoding never collide.
+static const uint8_t MTLModelFingerprintVersion = 2;
+
+static void MTLFingerprintAppendValue(CC_SHA256_CTX *context, id value);
+
+static void MTLFingerprintAppendBytes(CC_SHA256_CTX *context, const void *bytes, size_t length) {
+	// CC_SHA256_Update() takes a 32-bit length.
+	while (length > UINT32_MAX) {
+		CC_SHA256_Update(context, bytes, UINT32_MAX);
+		bytes = (const uint8_t *)bytes + UINT32_MAX;
+		length -= UINT32_MAX;
+	}
+
+	CC_SHA256_Update(context, bytes, (CC_LONG)length);
+}
+
+static void MTLFingerprintAppendTag(CC_SHA256_CTX *context, char tag) {
+	MTLFingerprintAppendBytes(context, &tag, sizeof(tag));
+}
+
+static void MTLFingerprintAppendInteger(CC_SHA256_CTX *context, uint64_t value) {
+	value = CFSwapInt64HostToLittle(value);
+	MTLFingerprintAppendBytes(context, &value, sizeof(value));
+}
+
+static void MTLFingerprintAppendString(CC_SHA256_CTX *context, NSString *string) {
+	const char *bytes = string.UTF8String;
+	NSUInteger length = (bytes != NULL ? [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding] : 0);
+
+	MTLFingerprintAppendInteger(context, length);
+	MTLFingerprintAppendBytes(context, bytes, length);
+}
+
+// Writes the first MTLModelFingerprintLength bytes of the SHA-256 digest of
+// the encoding of `value` into `digest`.
+static void MTLFingerprintDigestValue(id value, uint8_t *digest) {
+	CC_SHA256_CTX context;
+	CC_SHA256_Init(&context);
+	MTLFingerprintAppendValue(&context, value);
+
+	uint8_t fullDigest[CC_SHA256_DIGEST_LENGTH];
+	CC_SHA256_Final(fullDigest, &context);
+	memcpy(digest, fullDigest, MTLModelFingerprintLength);
+}
+
+// The digest of an element of an unordered collection, and the index of the
+// element, for sorting elements into a canonical order.
+typedef struct {
+	uint8_t digest[16];
+	NSUInteger index;
+} MTLFingerprintElementDigest;
+
+static int MTLFingerprintCompareElementDigests(const void *first, const void *second) {
+	return memcmp(((const MTLFingerprintElementDigest *)first)->digest, ((const MTLFingerprintElementDigest *)second)->digest, MTLModelFingerprintLength);
+}
+
+// Returns the digests of all `objects`, sorted by digest. The result must be
+// freed.
+static MTLFingerprintElementDigest *MTLFingerprintCopySortedDigests(NSArray *objects) {
+	MTLFingerprintElementDigest *digests = calloc(MAX(objects.count, 1), sizeof(*digests));
+
+	[objects enumerateObjectsUsingBlock:^(id object, NSUInteger index, BOOL *stop) {
+		MTLFingerprintDigestValue(object, digests[index].digest);
+		digests[index].index = index;
+	}];
+
+	qsort(digests, objects.count, sizeof(*digests), MTLFingerprintCompareElementDigests);
+	return digests;
+}
+
+static void MTLFingerprintAppendDouble(CC_SHA256_CTX *context, double value) {
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	MTLFingerprintAppendInteger(context, bits);
+}
+
+static void MTLFingerprintAppendNumber(CC_SHA256_CTX *context, NSNumber *number) {
+	if (number == (id)kCFBooleanTrue || number == (id)kCFBooleanFalse) {
+		MTLFingerprintAppendTag(context, 'b');
+		MTLFingerprintAppendTag(context, number.boolValue ? 1 : 0);
+		return;
+	}
+
+	char type = number.objCType[0];
+
+	if (type == 'f' || type == 'd') {
+		double value = number.doubleValue;
+
+		if (isnan(value)) {
+			MTLFingerprintAppendTag(context, 'd');
+			MTLFingerprintAppendDouble(context, NAN);
+			return;
+		}
+
+		// Encode integral values like integers, since they compare equal.
+		// This also folds -0.0 into 0.
+		if (value == trunc(value) && value >= -0x1p63 && value < 0x1p63) {
+			MTLFingerprintAppendTag(context, 'i');
+			MTLFingerprintAppendInteger(context, (uint64_t)(int64_t)value);
+			return;
+		}
+
+		MTLFingerprintAppendTag(context, 'd');
+		MTLFingerprintAppendDouble(context, value);
+		return;
+	}
+
+	if ((type == 'Q' || type == 'L') && number.unsignedLongLongValue > INT64_MAX) {
+		MTLFingerprintAppendTag(context, 'u');
+		MTLFingerprintAppendInteger(context, number.unsignedLongLongValue);
+		return;
+	}
+
+	MTLFingerprintAppendTag(context, 'i');
+	MTLFingerprintAppendInteger(context, (uint64_t)number.longLongValue);
+}
+
+// Appends the fields of the value of the Objective-C type `type` at `bytes`
+// one by one, so that padding between them doesn't affect the fingerprint.
+// Scalars are encoded like the NSNumbers holding them.
+//
+// Raises NSInvalidArgumentException if the value contains anything other than
+// numbers and BOOLs, like pointers, unions or bitfields.
+static void MTLFingerprintAppendEncodedValue(CC_SHA256_CTX *context, const char *type, const uint8_t *bytes) {
+	// Skip type qualifiers like `const`.
+	while (*type != '\0' && strchr("rnNoORV", *type) != NULL) type++;
+
+	NSUInteger size = 0;
+	NSGetSizeAndAlignment(type, &size, NULL);
+
+	switch (*type) {
+		case '{': {
+			const char *field = strchr(type, '=');
+			if (field == NULL) break;
+
+			NSUInteger offset = 0;
+
+			for (field++; *field != '}'; ) {
+				NSUInteger fieldSize = 0;
+				NSUInteger fieldAlignment = 1;
+				const char *nextField = NSGetSizeAndAlignment(field, &fieldSize, &fieldAlignment);
+
+				offset = (offset + fieldAlignment - 1) / fieldAlignment * fieldAlignment;
+				MTLFingerprintAppendEncodedValue(context, field, bytes + offset);
+
+				offset += fieldSize;
+				field = nextField;
+			}
+
+			return;
+		}
+
+		case '[': {
+			char *element = NULL;
+			unsigned long count = strtoul(type + 1, &element, 10);
+
+			NSUInteger elementSize = 0;
+			NSGetSizeAndAlignment(element, &elementSize, NULL);
+
+			for (unsigned long i = 0; i < count; i++) {
+				MTLFingerprintAppendEncodedValue(context, element, bytes + i * elementSize);
+			}
+
+			return;
+		}
+
+		case 'B': {
+			bool value;
+			memcpy(&value, bytes, sizeof(value));
+			MTLFingerprintAppendNumber(context, @(value));
+			return;
+		}
+
+		case 'c': case 's': case 'i': case 'l': case 'q': {
+			int64_t value = 0;
+			if (size == 1) value = *(const int8_t *)bytes;
+			if (size == 2) { int16_t field; memcpy(&field, bytes, size); value = field; }
+			if (size == 4) { int32_t field; memcpy(&field, bytes, size); value = field; }
+			if (size == 8) memcpy(&value, bytes, size);
+
+			MTLFingerprintAppendNumber(context, @(value));
+			return;
+		}
+
+		case 'C': case 'S': case 'I': case 'L': case 'Q': {
+			uint64_t value = 0;
+			if (size == 1) value = *bytes;
+			if (size == 2) { uint16_t field; memcpy(&field, bytes, size); value = field; }
+			if (size == 4) { uint32_t field; memcpy(&field, bytes, size); value = field; }
+			if (size == 8) memcpy(&value, bytes, size);
+
+			MTLFingerprintAppendNumber(context, @(value));
+			return;
+		}
+
+		case 'f': {
+			float value;
+			memcpy(&value, bytes, sizeof(value));
+			MTLFingerprintAppendNumber(context, @(value));
+			return;
+		}
+
+		case 'd': {
+			double value;
+			memcpy(&value, bytes, sizeof(value));
+			MTLFingerprintAppendNumber(context, @(value));
+			return;
+		}
+	}
+
+	[NSException raise:NSInvalidArgumentException format:@"Cannot fingerprint a value of Objective-C type %s by value", type];
+}
+
+static void MTLFingerprintAppendValue(CC_SHA256_CTX *context, id value) {
+	if (value == nil || value == NSNull.null) {
+		MTLFingerprintAppendTag(context, 'n');
+	} else if ([value isKindOfClass:MTLModel.class]) {
+		MTLFingerprintAppendTag(context, 'M');
+		MTLFingerprintAppendBytes(context, [value contentFingerprint].bytes, MTLModelFingerprintLength);
+	} else if ([value conformsToProtocol:@protocol(MTLModel)]) {
+		MTLFingerprintAppendTag(context, 'm');
+		MTLFingerprintAppendString(context, NSStringFromClass([value class]));
+		MTLFingerprintAppendValue(context, [value dictionaryValue]);
+	} else if ([value isKindOfClass:NSString.class]) {
+		MTLFingerprintAppendTag(context, 's');
+		MTLFingerprintAppendString(context, value);
+	} else if ([value isKindOfClass:NSNumber.class]) {
+		MTLFingerprintAppendNumber(context, value);
+	} else if ([value isKindOfClass:NSArray.class] || [value isKindOfClass:NSOrderedSet.class]) {
+		MTLFingerprintAppendTag(context, [value isKindOfClass:NSArray.class] ? 'a' : 'r');
+		MTLFingerprintAppendInteger(context, [value count]);
+
+		for (id element in value) {
+			MTLFingerprintAppendValue(context, element);
+		}
+	} else if ([value isKindOfClass:NSDictionary.class]) {
+		NSDictionary *dictionary = value;
+		NSArray *keys = dictionary.allKeys;
+		MTLFingerprintElementDigest *digests = MTLFingerprintCopySortedDigests(keys);
+
+		MTLFingerprintAppendTag(context, 'o');
+		MTLFingerprintAppendInteger(context, keys.count);
+
+		for (NSUInteger i = 0; i < keys.count; i++) {
+			MTLFingerprintAppendBytes(context, digests[i].digest, MTLModelFingerprintLength);
+			MTLFingerprintAppendValue(context, dictionary[keys[digests[i].index]]);
+		}
+
+		free(digests);
+	} else if ([value isKindOfClass:NSSet.class]) {
+		NSArray *elements = [value allObjects];
+		MTLFingerprintElementDigest *digests = MTLFingerprintCopySortedDigests(elements);
+
+		MTLFingerprintAppendTag(context, 'e');
+		MTLFingerprintAppendInteger(context, elements.count);
+
+		for (NSUInteger i = 0; i < elements.count; i++) {
+			MTLFingerprintAppendBytes(context, digests[i].digest, MTLModelFingerprintLength);
+		}
+
+		free(digests);
+	} else if ([value isKindOfClass:NSData.class]) {
+		MTLFingerprintAppendTag(context, 'x');
+		MTLFingerprintAppendInteger(context, [value length]);
+		MTLFingerprintAppendBytes(context, [value bytes], [value length]);
+	} else if ([value isKindOfClass:NSDate.class]) {
+		MTLFingerprintAppendTag(context, 't');
+		MTLFingerprintAppendDouble(context, [value timeIntervalSinceReferenceDate]);
+	} else if ([value isKindOfClass:NSURL.class]) {
+		MTLFingerprintAppendTag(context, 'l');
+		MTLFingerprintAppendString(context, [value absoluteString]);
+	} else if ([value isKindOfClass:NSUUID.class]) {
+		uuid_t bytes;
+		[value getUUIDBytes:bytes];
+
+		MTLFingerprintAppendTag(context, 'g');
+		MTLFingerprintAppendBytes(context, bytes, sizeof(bytes));
+	} else if ([value isKindOfClass:NSValue.class]) {
+		const char *type = [value objCType];
+		NSUInteger size = 0;
+		NSGetSizeAndAlignment(type, &size, NULL);
+
+		void *bytes = calloc(MAX(size, 1), 1);
+		@onExit {
+			free(bytes);
+		};
+
+		[value getValue:bytes];
+
+		MTLFingerprintAppendTag(context, 'v');
+		MTLFingerprintAppendString(context, @(type));
+		MTLFingerprintAppendEncodedValue(context, type, bytes);
+	} else {
+		// Descriptions usually contain the address of the object, which would
+		// make the fingerprint differ between processes.
+		[NSException raise:NSInvalidArgumentException format:@"Cannot fingerprint %@ of class %@ by value", value, [value class]];
+	}
+}
+
+@implementation MTLModel (Fingerprinting)
+
+- (NSData *)contentFingerprint {
+	BOOL immutable = self.class.isImmutable;
+
+	if (immutable) {
+		NSData *cachedFingerprint = self.cachedContentFingerprint;
+		if (cachedFingerprint != nil) return cachedFingerprint;
+	}
+
+	CC_SHA256_CTX context;
+	CC_SHA256_Init(&context);
+
+	MTLFingerprintAppendBytes(&context, &MTLModelFingerprintVersion, sizeof(MTLModelFingerprintVersion));
+	MTLFingerprintAppendString(&context, NSStringFromClass(self.class));
+
+	NSArray *accessors = self.class.permanentPropertyAccessors;
+	MTLFingerprintAppendInteger(&context, accessors.count);
+
+	for (MTLModelPropertyAccessor *accessor in accessors) {
+		MTLFingerprintAppendString(&context, accessor.key);
+		MTLFingerprintAppendValue(&context, [accessor valueForModel:self]);
+	}
+
+	uint8_t digest[CC_SHA256_DIGEST_LENGTH];
+	CC_SHA256_Final(digest, &context);
+
+	NSData *fingerprint = [NSData dataWithBytes:digest length:MTLModelFingerprintLength];
+
+	if (immutable) {
+		// It doesn't really matter if we replace another thread's work, since we
+		// do it atomically and the result should be the same.
+		self.cachedContentFingerprint = fingerprint;
+	}
+
+	return fingerprint;
+}
+
+@end
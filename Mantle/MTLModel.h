@@ -101,6 +101,11 @@ typedef NS_ENUM(NSInteger, MTLPropertyStorage) {
 ///
 /// The default implementations of <NSCopying>, -hash, and -isEqual: make use of
 /// the +propertyKeys method.
+///
+/// Copies of models are made by passing the value of each property from the
+/// getter of the receiver straight to the setter of the copy. Properties
+/// without a setter are set through key-value coding. Instances of classes for
+/// which +isImmutable returns YES are not copied at all.
 @interface MTLModel : NSObject <MTLModel, NSSecureCoding>
 
 /// By default, this method looks for a `-merge<Key>FromModel:` method on the
@@ -111,6 +116,13 @@ typedef NS_ENUM(NSInteger, MTLPropertyStorage) {
 /// Merges the values of the given model object into the receiver, using
 /// -mergeValueForKey:fromModel: for each key in +propertyKeys.
 ///
+/// The keys both classes share, and the `-merge<Key>FromModel:` methods, getters
+/// and setters to use for them, are only looked up the first time a model of
+/// the receiver's class merges a model of `model`'s class. Unless the receiver
+/// overrides -mergeValueForKey:fromModel:, keys without a custom merge method
+/// are copied by calling the getter of `model` and the setter of the receiver
+/// directly.
+///
 /// `model` must be an instance of the receiver's class or a subclass thereof.
 - (void)mergeValuesForKeysFromModel:(id<MTLModel>)model;
 
@@ -126,15 +138,71 @@ typedef NS_ENUM(NSInteger, MTLPropertyStorage) {
 /// Returns the storage behavior for a given key on the receiver.
 + (MTLPropertyStorage)storageBehaviorForPropertyWithKey:(NSString *)propertyKey;
 
+/// Whether instances of the receiver never change once they have been
+/// initialized.
+///
+/// Subclasses can override this method to return YES if none of their
+/// properties for which +storageBehaviorForPropertyWithKey: returns
+/// MTLPropertyStoragePermanent are modified after initialization, for
+/// example because they are all `readonly`. MTLModel will then return the
+/// receiver itself from -copy.
+///
+/// If the values of all those properties are immutable as well, MTLModel also
+/// computes the -hash of each instance only once and uses it to speed up
+/// -isEqual:, and other values derived from the properties are memoized, too.
+/// Values count as immutable if they are nil, models that meet the same
+/// condition, or objects which return themselves from -copy, like NSString or
+/// NSArray but unlike NSMutableString or NSMutableArray, with immutable
+/// elements in case of collections. An instance holding a mutable model or
+/// collection anywhere in its properties memoizes nothing, so that mutating
+/// those values in place is always reflected. This is checked once per
+/// instance.
+///
+/// Setting a property through key-value coding or merging it from another model
+/// discards everything memoized for the instance, like its -hash, but not for
+/// the immutable models holding it. Changing a permanent property of an
+/// immutable model by calling its setter directly after its -hash has been
+/// computed results in undefined behavior.
+///
+/// The default implementation returns NO.
++ (BOOL)isImmutable;
+
+/// Whether the `@dynamic` properties of the receiver are stored compactly.
+///
+/// Subclasses can override this method to return YES to have MTLModel provide
+/// the accessors of their readwrite `@dynamic` properties, keeping all of their
+/// values in a single allocation per instance. Objects take up no space while
+/// they are nil, and numbers and BOOLs are packed into as few bits as their
+/// types need. This suits models with many properties that are usually unset.
+///
+/// Compactly stored properties are always nonatomic, and must be strong or
+/// copied objects, BOOLs, or integer or floating-point numbers. Properties of
+/// superclasses which also use compact storage are stored alongside those of
+/// the receiver. Accessors that a class implements itself are left alone.
+///
+/// The default implementation returns NO.
++ (BOOL)usesCompactStorage;
+
 /// Compares the receiver with another object for equality.
 ///
 /// The default implementation is equivalent to comparing all properties of both
 /// models for which +storageBehaviorForPropertyWithKey: returns
-/// MTLPropertyStoragePermanent.
+/// MTLPropertyStoragePermanent. Property getters are invoked directly rather
+/// than through key-value coding. Immutable models whose hashes have already
+/// been computed are first compared by hash.
 ///
 /// Returns YES if the two models are considered equal, NO otherwise.
 - (BOOL)isEqual:(id)object;
 
+/// A hash of the receiver.
+///
+/// The default implementation combines the values of all properties for which
+/// +storageBehaviorForPropertyWithKey: returns MTLPropertyStoragePermanent, in
+/// order of their keys, so that models whose values only differ by their
+/// arrangement hash differently. If +isImmutable returns YES and all those
+/// values are immutable, the hash is computed once and cached.
+@property (readonly) NSUInteger hash;
+
 /// A string that describes the contents of the receiver.
 ///
 /// The default implementation is based on the receiver's class and all its
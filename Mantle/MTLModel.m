@@ -7,11 +7,14 @@
 //
 
 #import "NSError+MTLModelException.h"
-#import "MTLModel.h"
+#import "MTLCompactStorage.h"
+#import "MTLModel_Private.h"
 #import <Mantle/EXTRuntimeExtensions.h>
 #import <Mantle/EXTScope.h>
 #import "MTLReflection.h"
+#import <math.h>
 #import <objc/runtime.h>
+#import <stdatomic.h>
 #import "NSKeyValueCoding+MTLValidationAdditions.h"
 
 // Used to cache the reflection performed in +propertyKeys.
@@ -25,20 +28,351 @@ static void *MTLModelCachedTransitoryPropertyKeysKey = &MTLModelCachedTransitory
 // property keys.
 static void *MTLModelCachedPermanentPropertyKeysKey = &MTLModelCachedPermanentPropertyKeysKey;
 
+// Associated in +permanentPropertyAccessors with an array of
+// MTLModelPropertyAccessors for all permanent properties, sorted by key.
+static void *MTLModelCachedPermanentPropertyAccessorsKey = &MTLModelCachedPermanentPropertyAccessorsKey;
+
+// Associated in +transitoryPropertyAccessors with an array of
+// MTLModelPropertyAccessors for all transitory properties, sorted by key.
+static void *MTLModelCachedTransitoryPropertyAccessorsKey = &MTLModelCachedTransitoryPropertyAccessorsKey;
+
+// Associated in +mergePlanForModelClass: with a dictionary of merge plans,
+// keyed by the class of the model merged from.
+static void *MTLModelCachedMergePlansKey = &MTLModelCachedMergePlansKey;
+
+// Mixes the hash of a single property value into the hash of a model.
+static inline uint64_t MTLModelHashCombine(uint64_t hash, uint64_t value) {
+	return ((hash << 5 | hash >> 59) ^ value) * 0x9E3779B97F4A7C15ULL;
+}
+
+// Spreads the bits of a combined hash over the whole result, so that hash
+// tables using only the low bits still see every property.
+static inline uint64_t MTLModelHashFinalize(uint64_t hash) {
+	hash ^= hash >> 33;
+	hash *= 0xFF51AFD7ED558CCDULL;
+	hash ^= hash >> 33;
+	hash *= 0xC4CEB9FE1A85EC53ULL;
+	hash ^= hash >> 33;
+	return hash;
+}
+
+@implementation MTLModelPropertyAccessor {
+	SEL _getter;
+	IMP _getterIMP;
+
+	// The setter of the property, if it is read directly and has a setter.
+	// Otherwise, values are set through key-value coding.
+	SEL _setter;
+	IMP _setterIMP;
+
+	// The Objective-C type encoding character of the property, or 0 if the
+	// property is read through key-value coding.
+	char _type;
+}
+
+- (instancetype)initWithKey:(NSString *)key modelClass:(Class)modelClass {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_key = [key copy];
+
+	objc_property_t property = class_getProperty(modelClass, key.UTF8String);
+	if (property == NULL) return self;
+
+	mtl_propertyAttributes *attributes = mtl_copyPropertyAttributes(property);
+	if (attributes == NULL) return self;
+
+	@onExit {
+		free(attributes);
+	};
+
+	if (![modelClass instancesRespondToSelector:attributes->getter]) return self;
+
+	const char *type = attributes->type;
+	// Skip qualifiers like `const`, and only read objects and numbers directly.
+	while (*type != '\0' && strchr("rnNoORV", *type) != NULL) type++;
+	if (*type == '\0' || strchr("@cCsSiIlLqQBfd", *type) == NULL) return self;
+
+	_getter = attributes->getter;
+	_getterIMP = class_getMethodImplementation(modelClass, _getter);
+	_type = *type;
+
+	if (!attributes->readonly && [modelClass instancesRespondToSelector:attributes->setter]) {
+		_setter = attributes->setter;
+		_setterIMP = class_getMethodImplementation(modelClass, _setter);
+	}
+
+	return self;
+}
+
+// Reads an integer property of any size and signedness.
+static inline int64_t MTLModelPropertyIntegerValue(id model, SEL getter, IMP imp, char type) {
+	switch (type) {
+		case 'c': return ((char (*)(id, SEL))imp)(model, getter);
+		case 'C': return ((unsigned char (*)(id, SEL))imp)(model, getter);
+		case 's': return ((short (*)(id, SEL))imp)(model, getter);
+		case 'S': return ((unsigned short (*)(id, SEL))imp)(model, getter);
+		case 'i': return ((int (*)(id, SEL))imp)(model, getter);
+		case 'I': return ((unsigned int (*)(id, SEL))imp)(model, getter);
+		case 'l': return ((long (*)(id, SEL))imp)(model, getter);
+		case 'L': return (int64_t)((unsigned long (*)(id, SEL))imp)(model, getter);
+		case 'q': return ((long long (*)(id, SEL))imp)(model, getter);
+		case 'Q': return (int64_t)((unsigned long long (*)(id, SEL))imp)(model, getter);
+		case 'B': return ((bool (*)(id, SEL))imp)(model, getter);
+		default: return 0;
+	}
+}
+
+// Reads a floating-point property.
+static inline double MTLModelPropertyFloatingPointValue(id model, SEL getter, IMP imp, char type) {
+	if (type == 'f') return ((float (*)(id, SEL))imp)(model, getter);
+
+	return ((double (*)(id, SEL))imp)(model, getter);
+}
+
+- (id)valueForModel:(id)model {
+#define MTLModelBoxedValueOfType(TYPE) \
+	@(((TYPE (*)(id, SEL))_getterIMP)(model, _getter))
+
+	// Box numbers the same way key-value coding does.
+	switch (_type) {
+		case '@': return ((id (*)(id, SEL))_getterIMP)(model, _getter);
+		case 'c': return MTLModelBoxedValueOfType(char);
+		case 'C': return MTLModelBoxedValueOfType(unsigned char);
+		case 's': return MTLModelBoxedValueOfType(short);
+		case 'S': return MTLModelBoxedValueOfType(unsigned short);
+		case 'i': return MTLModelBoxedValueOfType(int);
+		case 'I': return MTLModelBoxedValueOfType(unsigned int);
+		case 'l': return MTLModelBoxedValueOfType(long);
+		case 'L': return MTLModelBoxedValueOfType(unsigned long);
+		case 'q': return MTLModelBoxedValueOfType(long long);
+		case 'Q': return MTLModelBoxedValueOfType(unsigned long long);
+		case 'B': return MTLModelBoxedValueOfType(bool);
+		case 'f': return MTLModelBoxedValueOfType(float);
+		case 'd': return MTLModelBoxedValueOfType(double);
+		default: return [model valueForKey:_key];
+	}
+
+#undef MTLModelBoxedValueOfType
+}
+
+- (void)copyValueFromModel:(id)sourceModel toModel:(id)model {
+	[self copyValueFromModel:sourceModel sourceAccessor:self toModel:model];
+}
+
+- (void)copyValueFromModel:(id)sourceModel sourceAccessor:(MTLModelPropertyAccessor *)sourceAccessor toModel:(id)model {
+	if (_setterIMP == NULL || sourceAccessor->_type != _type) {
+		[model setValue:[sourceAccessor valueForModel:sourceModel] forKey:_key];
+		return;
+	}
+
+	SEL getter = sourceAccessor->_getter;
+	IMP getterIMP = sourceAccessor->_getterIMP;
+
+#define MTLModelCopyValueOfType(TYPE) \
+	((void (*)(id, SEL, TYPE))_setterIMP)(model, _setter, ((TYPE (*)(id, SEL))getterIMP)(sourceModel, getter))
+
+	switch (_type) {
+		case '@': MTLModelCopyValueOfType(id); break;
+		case 'c': MTLModelCopyValueOfType(char); break;
+		case 'C': MTLModelCopyValueOfType(unsigned char); break;
+		case 's': MTLModelCopyValueOfType(short); break;
+		case 'S': MTLModelCopyValueOfType(unsigned short); break;
+		case 'i': MTLModelCopyValueOfType(int); break;
+		case 'I': MTLModelCopyValueOfType(unsigned int); break;
+		case 'l': MTLModelCopyValueOfType(long); break;
+		case 'L': MTLModelCopyValueOfType(unsigned long); break;
+		case 'q': MTLModelCopyValueOfType(long long); break;
+		case 'Q': MTLModelCopyValueOfType(unsigned long long); break;
+		case 'B': MTLModelCopyValueOfType(bool); break;
+		case 'f': MTLModelCopyValueOfType(float); break;
+		case 'd': MTLModelCopyValueOfType(double); break;
+	}
+
+#undef MTLModelCopyValueOfType
+}
+
+- (BOOL)isValueOfModel:(id)model equalToValueOfModel:(id)otherModel {
+	switch (_type) {
+		case 0:
+		case '@': {
+			id value = [self valueForModel:model];
+			id otherValue = [self valueForModel:otherModel];
+
+			return value == otherValue || [value isEqual:otherValue];
+		}
+
+		case 'f':
+		case 'd': {
+			double value = MTLModelPropertyFloatingPointValue(model, _getter, _getterIMP, _type);
+			double otherValue = MTLModelPropertyFloatingPointValue(otherModel, _getter, _getterIMP, _type);
+
+			return value == otherValue || (isnan(value) && isnan(otherValue));
+		}
+
+		default:
+			return MTLModelPropertyIntegerValue(model, _getter, _getterIMP, _type) == MTLModelPropertyIntegerValue(otherModel, _getter, _getterIMP, _type);
+	}
+}
+
+- (uint64_t)hashOfValueForModel:(id)model {
+	switch (_type) {
+		case 0:
+		case '@':
+			return [[self valueForModel:model] hash];
+
+		case 'f':
+		case 'd': {
+			double value = MTLModelPropertyFloatingPointValue(model, _getter, _getterIMP, _type);
+
+			// Values which compare equal must hash the same.
+			if (value == 0) return 0;
+			if (isnan(value)) return UINT64_MAX;
+
+			uint64_t bits;
+			memcpy(&bits, &value, sizeof(bits));
+			return bits;
+		}
+
+		default:
+			return (uint64_t)MTLModelPropertyIntegerValue(model, _getter, _getterIMP, _type);
+	}
+}
+
+@end
+
+// Merges the value of one key from another model, as
+// -mergeValueForKey:fromModel: would, with all the lookups done up front.
+@interface MTLModelMergeStep : NSObject
+
+- (instancetype)initWithKey:(NSString *)key modelClass:(Class)modelClass sourceClass:(Class)sourceClass;
+
+- (void)mergeValueFromModel:(id<MTLModel>)sourceModel intoModel:(MTLModel *)model;
+
+@end
+
+@implementation MTLModelMergeStep {
+	NSString *_key;
+
+	// The `-merge<Key>FromModel:` method of the model class, if implemented.
+	SEL _mergeSelector;
+	IMP _mergeIMP;
+
+	// Whether the model class overrides -mergeValueForKey:fromModel:, in which
+	// case that is always invoked.
+	BOOL _overridesMerge;
+
+	MTLModelPropertyAccessor *_accessor;
+	MTLModelPropertyAccessor *_sourceAccessor;
+}
+
+- (instancetype)initWithKey:(NSString *)key modelClass:(Class)modelClass sourceClass:(Class)sourceClass {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_key = [key copy];
+
+	SEL mergeValueSelector = @selector(mergeValueForKey:fromModel:);
+	_overridesMerge = class_getMethodImplementation(modelClass, mergeValueSelector) != class_getMethodImplementation(MTLModel.class, mergeValueSelector);
+	if (_overridesMerge) return self;
+
+	SEL selector = MTLSelectorWithCapitalizedKeyPattern("merge", key, "FromModel:");
+	if (selector != NULL && [modelClass instancesRespondToSelector:selector]) {
+		_mergeSelector = selector;
+		_mergeIMP = class_getMethodImplementation(modelClass, selector);
+		return self;
+	}
+
+	_accessor = [[MTLModelPropertyAccessor alloc] initWithKey:key modelClass:modelClass];
+	_sourceAccessor = [[MTLModelPropertyAccessor alloc] initWithKey:key modelClass:sourceClass];
+
+	return self;
+}
+
+- (void)mergeValueFromModel:(id<MTLModel>)sourceModel intoModel:(MTLModel *)model {
+	if (_overridesMerge) {
+		[model mergeValueForKey:_key fromModel:sourceModel];
+	} else if (_mergeIMP != NULL) {
+		((void (*)(id, SEL, id<MTLModel>))_mergeIMP)(model, _mergeSelector, sourceModel);
+	} else {
+		[_accessor copyValueFromModel:sourceModel sourceAccessor:_sourceAccessor toModel:model];
+	}
+}
+
+@end
+
+// Whether an immutable model may memoize values derived from its properties.
+typedef NS_ENUM(NSInteger, MTLModelMemoization) {
+	// The values of the model haven't been inspected yet.
+	MTLModelMemoizationUnknown = 0,
+
+	// All values of the model are immutable as well.
+	MTLModelMemoizationAllowed,
+
+	// The model holds a mutable value, which could change what would be
+	// memoized.
+	MTLModelMemoizationDisallowed,
+};
+
+// The values memoized for an immutable model.
+//
+// Each immutable model creates one of these the first time it memoizes a
+// value, and keeps it until it is deallocated, so that other models don't pay
+// for memoization at all.
+@interface MTLModelCachedValues : NSObject {
+@package
+	// The hash of the model, or 0 if it hasn't been computed yet.
+	_Atomic(NSUInteger) _hash;
+
+	// An MTLModelMemoization.
+	_Atomic(NSInteger) _memoization;
+}
+
+// The JSON dictionaries MTLJSONAdapter serialized the model into, keyed by
+// the class of the adapter.
+@property (atomic, copy) NSDictionary *JSONDictionaries;
+
+// The -contentFingerprint of the model, if it has already been computed.
+@property (atomic, copy) NSData *contentFingerprint;
+
+// Discards all values, including whether the model may memoize any.
+- (void)invalidate;
+
+@end
+
+@implementation MTLModelCachedValues
+
+- (void)invalidate {
+	atomic_store_explicit(&_hash, 0, memory_order_relaxed);
+	atomic_store_explicit(&_memoization, MTLModelMemoizationUnknown, memory_order_relaxed);
+
+	if (self.JSONDictionaries != nil) self.JSONDictionaries = nil;
+	if (self.contentFingerprint != nil) self.contentFingerprint = nil;
+}
+
+@end
+
 @interface MTLModel ()
 
+// The MTLModelCachedValues of the receiver, or nil if it hasn't memoized
+// anything yet.
+@property (nonatomic, strong, readonly) MTLModelCachedValues *cachedValues;
+
+// Returns the MTLModelCachedValues to memoize values of the receiver in,
+// creating it if necessary, or nil if the receiver must not memoize anything.
+//
+// Only immutable models whose values are all immutable may memoize values,
+// since mutating any of them would make the memoized values stale.
+- (MTLModelCachedValues *)memoizingCachedValues;
+
+// Returns an array of MTLModelMergeSteps for all keys the receiver shares
+// with `modelClass`, which -mergeValuesForKeysFromModel: performs in order.
++ (NSArray *)mergePlanForModelClass:(Class)modelClass;
+
 // Inspects all properties of returned by +propertyKeys using
 // +storageBehaviorForPropertyWithKey and caches the results.
 + (void)generateAndCacheStorageBehaviors;
 
-// Returns a set of all property keys for which
-// +storageBehaviorForPropertyWithKey returned MTLPropertyStorageTransitory.
-+ (NSSet *)transitoryPropertyKeys;
-
-// Returns a set of all property keys for which
-// +storageBehaviorForPropertyWithKey returned MTLPropertyStoragePermanent.
-+ (NSSet *)permanentPropertyKeys;
-
 // Enumerates all properties of the receiver's class hierarchy, starting at the
 // receiver, and continuing up until (but not including) MTLModel.
 //
@@ -46,13 +380,51 @@ static void *MTLModelCachedPermanentPropertyKeysKey = &MTLModelCachedPermanentPr
 // multiple classes in the hierarchy.
 + (void)enumeratePropertiesUsingBlock:(void (^)(objc_property_t property, BOOL *stop))block;
 
+// Returns an array of MTLModelPropertyAccessors for the given keys, sorted by
+// key.
++ (NSArray *)propertyAccessorsForKeys:(NSSet *)keys;
+
 @end
 
+// Returns whether `value` can never change, so that an immutable model holding
+// it may memoize values derived from it.
+//
+// Immutable Foundation objects, unlike their mutable variants, return
+// themselves from -copy. The contents of collections must be immutable, too.
+static BOOL MTLModelValueIsImmutable(id value) {
+	if (value == nil) return YES;
+
+	if ([value isKindOfClass:MTLModel.class]) return [value memoizingCachedValues] != nil;
+
+	if (![value conformsToProtocol:@protocol(NSCopying)]) return NO;
+
+	id copy = [value copy];
+	if (copy != value) return NO;
+
+	if ([value isKindOfClass:NSDictionary.class]) value = [value allValues];
+
+	if ([value isKindOfClass:NSArray.class] || [value isKindOfClass:NSSet.class] || [value isKindOfClass:NSOrderedSet.class]) {
+		for (id element in value) {
+			if (!MTLModelValueIsImmutable(element)) return NO;
+		}
+	}
+
+	return YES;
+}
+
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wprotocol"
 // See MTLModel+NSCoding.
 
-@implementation MTLModel
+@implementation MTLModel {
+	// The MTLModelCachedValues of an immutable model, retained, or NULL if it
+	// hasn't memoized anything yet.
+	_Atomic(void *) _cachedValues;
+
+	// The values of compactly stored properties, which are managed by
+	// MTLCompactStorage, or NULL if none has been set.
+	void *_compactStorage;
+}
 
 #pragma mark Lifecycle
 
@@ -90,6 +462,19 @@ static void *MTLModelCachedPermanentPropertyKeysKey = &MTLModelCachedPermanentPr
 	return [super init];
 }
 
+- (void)dealloc {
+	if (_compactStorage != NULL) MTLCompactStorageDestroy(_compactStorage);
+
+	void *cachedValues = atomic_load_explicit(&_cachedValues, memory_order_relaxed);
+	if (cachedValues != NULL) CFRelease(cachedValues);
+}
+
++ (BOOL)resolveInstanceMethod:(SEL)selector {
+	if (self.usesCompactStorage && MTLCompactStorageResolveAccessor(self, selector)) return YES;
+
+	return [super resolveInstanceMethod:selector];
+}
+
 - (instancetype)initWithDictionary:(NSDictionary *)dictionary error:(NSError **)error {
 	self = [self init];
 	if (self == nil) return nil;
@@ -176,10 +561,63 @@ static void *MTLModelCachedPermanentPropertyKeysKey = &MTLModelCachedPermanentPr
 	return permanentPropertyKeys;
 }
 
++ (NSArray *)permanentPropertyAccessors {
+	NSArray *accessors = objc_getAssociatedObject(self, MTLModelCachedPermanentPropertyAccessorsKey);
+	if (accessors != nil) return accessors;
+
+	accessors = [self propertyAccessorsForKeys:self.permanentPropertyKeys];
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(self, MTLModelCachedPermanentPropertyAccessorsKey, accessors, OBJC_ASSOCIATION_COPY);
+
+	return accessors;
+}
+
++ (NSArray *)transitoryPropertyAccessors {
+	NSArray *accessors = objc_getAssociatedObject(self, MTLModelCachedTransitoryPropertyAccessorsKey);
+	if (accessors != nil) return accessors;
+
+	accessors = [self propertyAccessorsForKeys:self.transitoryPropertyKeys];
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(self, MTLModelCachedTransitoryPropertyAccessorsKey, accessors, OBJC_ASSOCIATION_COPY);
+
+	return accessors;
+}
+
++ (NSArray *)propertyAccessorsForKeys:(NSSet *)keys {
+	NSArray *sortedKeys = [keys.allObjects sortedArrayUsingSelector:@selector(compare:)];
+	NSMutableArray *accessors = [NSMutableArray arrayWithCapacity:sortedKeys.count];
+
+	for (NSString *key in sortedKeys) {
+		[accessors addObject:[[MTLModelPropertyAccessor alloc] initWithKey:key modelClass:self]];
+	}
+
+	return accessors;
+}
+
 - (NSDictionary *)dictionaryValue {
-	NSSet *keys = [self.class.transitoryPropertyKeys setByAddingObjectsFromSet:self.class.permanentPropertyKeys];
+	NSArray *permanentAccessors = self.class.permanentPropertyAccessors;
+	NSArray *transitoryAccessors = self.class.transitoryPropertyAccessors;
+	NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithCapacity:permanentAccessors.count + transitoryAccessors.count];
+
+	for (NSArray *accessors in @[ permanentAccessors, transitoryAccessors ]) {
+		for (MTLModelPropertyAccessor *accessor in accessors) {
+			dictionary[accessor.key] = [accessor valueForModel:self] ?: NSNull.null;
+		}
+	}
+
+	return dictionary;
+}
 
-	return [self dictionaryWithValuesForKeys:keys.allObjects];
++ (BOOL)isImmutable {
+	return NO;
+}
+
++ (BOOL)usesCompactStorage {
+	return NO;
 }
 
 + (MTLPropertyStorage)storageBehaviorForPropertyWithKey:(NSString *)propertyKey {
@@ -228,14 +666,43 @@ static void *MTLModelCachedPermanentPropertyKeysKey = &MTLModelCachedPermanentPr
 	function(self, selector, model);
 }
 
-- (void)mergeValuesForKeysFromModel:(id<MTLModel>)model {
-	NSSet *propertyKeys = model.class.propertyKeys;
++ (NSArray *)mergePlanForModelClass:(Class)modelClass {
+	NSDictionary *cachedPlans = objc_getAssociatedObject(self, MTLModelCachedMergePlansKey);
+	NSArray *plan = cachedPlans[modelClass];
+	if (plan != nil) return plan;
 
-	for (NSString *key in self.class.propertyKeys) {
+	NSSet *propertyKeys = [modelClass propertyKeys];
+	NSMutableArray *steps = [NSMutableArray array];
+
+	for (NSString *key in self.propertyKeys) {
 		if (![propertyKeys containsObject:key]) continue;
 
-		[self mergeValueForKey:key fromModel:model];
+		[steps addObject:[[MTLModelMergeStep alloc] initWithKey:key modelClass:self sourceClass:modelClass]];
+	}
+
+	plan = [steps copy];
+
+	NSMutableDictionary *plans = [NSMutableDictionary dictionaryWithDictionary:cachedPlans ?: @{}];
+	plans[(id<NSCopying>)modelClass] = plan;
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and a lost plan is simply created again.
+	objc_setAssociatedObject(self, MTLModelCachedMergePlansKey, plans, OBJC_ASSOCIATION_COPY);
+
+	return plan;
+}
+
+- (void)mergeValuesForKeysFromModel:(id<MTLModel>)model {
+	if (model == nil) return;
+
+	// Look up methods on the actual class of the receiver, so that setters
+	// still notify any key-value observers.
+	for (MTLModelMergeStep *step in [object_getClass(self) mergePlanForModelClass:model.class]) {
+		[step mergeValueFromModel:model intoModel:self];
 	}
+
+	// Merge steps may call setters directly.
+	[self invalidateCachedValues];
 }
 
 #pragma mark Validation
@@ -251,11 +718,30 @@ static void *MTLModelCachedPermanentPropertyKeysKey = &MTLModelCachedPermanentPr
 	return YES;
 }
 
+#pragma mark NSKeyValueCoding
+
+- (void)setValue:(id)value forKey:(NSString *)key {
+	[super setValue:value forKey:key];
+
+	// Most models never memoize anything, and have nothing to invalidate.
+	if (atomic_load_explicit(&_cachedValues, memory_order_relaxed) != NULL) [self invalidateCachedValues];
+}
+
 #pragma mark NSCopying
 
 - (instancetype)copyWithZone:(NSZone *)zone {
+	if (self.class.isImmutable) return self;
+
 	MTLModel *copy = [[self.class allocWithZone:zone] init];
-	[copy setValuesForKeysWithDictionary:self.dictionaryValue];
+
+	for (MTLModelPropertyAccessor *accessor in self.class.permanentPropertyAccessors) {
+		[accessor copyValueFromModel:self toModel:copy];
+	}
+
+	for (MTLModelPropertyAccessor *accessor in self.class.transitoryPropertyAccessors) {
+		[accessor copyValueFromModel:self toModel:copy];
+	}
+
 	return copy;
 }
 
@@ -268,25 +754,111 @@ static void *MTLModelCachedPermanentPropertyKeysKey = &MTLModelCachedPermanentPr
 }
 
 - (NSUInteger)hash {
-	NSUInteger value = 0;
+	NSUInteger cachedHash = self.cachedHash;
+	if (cachedHash != 0) return cachedHash;
+
+	uint64_t value = 0;
+
+	for (MTLModelPropertyAccessor *accessor in self.class.permanentPropertyAccessors) {
+		value = MTLModelHashCombine(value, [accessor hashOfValueForModel:self]);
+	}
+
+	NSUInteger hash = (NSUInteger)MTLModelHashFinalize(value);
+
+	MTLModelCachedValues *cachedValues = self.memoizingCachedValues;
+	if (cachedValues != nil) {
+		// Reserve 0 for hashes that haven't been computed.
+		if (hash == 0) hash = 1;
+
+		atomic_store_explicit(&cachedValues->_hash, hash, memory_order_relaxed);
+	}
+
+	return hash;
+}
 
-	for (NSString *key in self.class.permanentPropertyKeys) {
-		value ^= [[self valueForKey:key] hash];
+#pragma mark Memoization
+
+- (MTLModelCachedValues *)cachedValues {
+	return (__bridge MTLModelCachedValues *)atomic_load_explicit(&_cachedValues, memory_order_acquire);
+}
+
+- (MTLModelCachedValues *)memoizingCachedValues {
+	if (!self.class.isImmutable) return nil;
+
+	MTLModelCachedValues *cachedValues = self.cachedValues;
+
+	if (cachedValues == nil) {
+		// Another thread may have created one in the meantime, which then wins.
+		void *newCachedValues = (__bridge_retained void *)[[MTLModelCachedValues alloc] init];
+		void *expected = NULL;
+
+		if (atomic_compare_exchange_strong(&_cachedValues, &expected, newCachedValues)) {
+			cachedValues = (__bridge MTLModelCachedValues *)newCachedValues;
+		} else {
+			CFRelease(newCachedValues);
+			cachedValues = (__bridge MTLModelCachedValues *)expected;
+		}
+	}
+
+	MTLModelMemoization memoization = atomic_load_explicit(&cachedValues->_memoization, memory_order_relaxed);
+
+	if (memoization == MTLModelMemoizationUnknown) {
+		memoization = MTLModelMemoizationAllowed;
+
+		for (MTLModelPropertyAccessor *accessor in self.class.permanentPropertyAccessors) {
+			if (!MTLModelValueIsImmutable([accessor valueForModel:self])) {
+				memoization = MTLModelMemoizationDisallowed;
+				break;
+			}
+		}
+
+		atomic_store_explicit(&cachedValues->_memoization, memoization, memory_order_relaxed);
 	}
 
-	return value;
+	return (memoization == MTLModelMemoizationAllowed ? cachedValues : nil);
+}
+
+- (NSUInteger)cachedHash {
+	MTLModelCachedValues *cachedValues = self.cachedValues;
+	if (cachedValues == nil) return 0;
+
+	return atomic_load_explicit(&cachedValues->_hash, memory_order_relaxed);
+}
+
+- (NSDictionary *)cachedJSONDictionaries {
+	return self.cachedValues.JSONDictionaries;
+}
+
+- (void)setCachedJSONDictionaries:(NSDictionary *)JSONDictionaries {
+	MTLModelCachedValues *cachedValues = (JSONDictionaries != nil ? self.memoizingCachedValues : self.cachedValues);
+	cachedValues.JSONDictionaries = JSONDictionaries;
+}
+
+- (NSData *)cachedContentFingerprint {
+	return self.cachedValues.contentFingerprint;
+}
+
+- (void)setCachedContentFingerprint:(NSData *)contentFingerprint {
+	MTLModelCachedValues *cachedValues = (contentFingerprint != nil ? self.memoizingCachedValues : self.cachedValues);
+	cachedValues.contentFingerprint = contentFingerprint;
+}
+
+- (void)invalidateCachedValues {
+	[self.cachedValues invalidate];
 }
 
 - (BOOL)isEqual:(MTLModel *)model {
 	if (self == model) return YES;
 	if (![model isMemberOfClass:self.class]) return NO;
 
-	for (NSString *key in self.class.permanentPropertyKeys) {
-		id selfValue = [self valueForKey:key];
-		id modelValue = [model valueForKey:key];
+	// Only immutable models cache their hash, and for those, differing hashes
+	// settle the comparison without looking at any property.
+	NSUInteger hash = self.cachedHash;
+	NSUInteger modelHash = (hash != 0 ? model.cachedHash : 0);
+	if (hash != 0 && modelHash != 0 && hash != modelHash) return NO;
 
-		BOOL valuesEqual = ((selfValue == nil && modelValue == nil) || [selfValue isEqual:modelValue]);
-		if (!valuesEqual) return NO;
+	for (MTLModelPropertyAccessor *accessor in self.class.permanentPropertyAccessors) {
+		if (![accessor isValueOfModel:self equalToValueOfModel:model]) return NO;
 	}
 
 	return YES;
@@ -0,0 +1,89 @@
+//
+//  MTLModel_Private.h
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLModel.h"
+
+// Reads, copies, compares and hashes the value of one property of a model,
+// calling its getter and setter directly instead of going through key-value
+// coding.
+//
+// Accessors are created for a specific class, and must only be used with
+// instances of that class.
+@interface MTLModelPropertyAccessor : NSObject
+
+// The key of the property.
+@property (nonatomic, copy, readonly) NSString *key;
+
+- (instancetype)initWithKey:(NSString *)key modelClass:(Class)modelClass;
+
+// Returns the value of the property on `model`, boxed if it is not an object.
+- (id)valueForModel:(id)model;
+
+// Sets the property of `model` to its value on `sourceModel`, calling the
+// setter directly if possible.
+- (void)copyValueFromModel:(id)sourceModel toModel:(id)model;
+
+// Sets the property of `model` to the value of the same property on
+// `sourceModel`, which is read through `sourceAccessor`. The two accessors may
+// belong to different classes. The getter and setter are called directly if
+// both accessors agree on the type of the property.
+- (void)copyValueFromModel:(id)sourceModel sourceAccessor:(MTLModelPropertyAccessor *)sourceAccessor toModel:(id)model;
+
+// Returns whether the property has equal values on `model` and `otherModel`.
+- (BOOL)isValueOfModel:(id)model equalToValueOfModel:(id)otherModel;
+
+// Returns a hash of the value of the property on `model`, which is the same
+// for values that -isValueOfModel:equalToValueOfModel: considers equal.
+- (uint64_t)hashOfValueForModel:(id)model;
+
+@end
+
+@interface MTLModel ()
+
+// Returns a set of all property keys for which
+// +storageBehaviorForPropertyWithKey returned MTLPropertyStorageTransitory.
++ (NSSet *)transitoryPropertyKeys;
+
+// Returns a set of all property keys for which
+// +storageBehaviorForPropertyWithKey returned MTLPropertyStoragePermanent.
++ (NSSet *)permanentPropertyKeys;
+
+// Returns an array of MTLModelPropertyAccessors for all
+// +permanentPropertyKeys, sorted by key.
++ (NSArray *)permanentPropertyAccessors;
+
+// Returns an array of MTLModelPropertyAccessors for all
+// +transitoryPropertyKeys, sorted by key.
++ (NSArray *)transitoryPropertyAccessors;
+
+// The hash of an immutable model if it has already been computed, or 0
+// otherwise.
+@property (nonatomic, assign, readonly) NSUInteger cachedHash;
+
+// The JSON dictionaries MTLJSONAdapter serialized an immutable model into,
+// keyed by the class of the adapter.
+//
+// Setting this has no effect unless all values of the model are immutable, as
+// described for +isImmutable.
+@property (atomic, copy) NSDictionary *cachedJSONDictionaries;
+
+// The -contentFingerprint of an immutable model, if it has already been
+// computed.
+//
+// Setting this has no effect unless all values of the model are immutable, as
+// described for +isImmutable.
+@property (atomic, copy) NSData *cachedContentFingerprint;
+
+// Discards the hash, fingerprint and JSON dictionaries memoized for the
+// receiver.
+//
+// This is invoked whenever a property is set through key-value coding or
+// merged from another model.
+- (void)invalidateCachedValues;
+
+@end
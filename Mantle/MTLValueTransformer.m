@@ -6,34 +6,7 @@
 //  Copyright (c) 2012 GitHub. All rights reserved.
 //
 
-#import "MTLValueTransformer.h"
-
-/// A block that represents a transformation.
-///
-/// value   - The value to transform.
-/// success - The block must set this parameter to indicate whether the
-///           transformation was successful.
-///           MTLValueTransformer will always call this block with *success
-///           initialized to YES.
-/// error   - If not NULL, this may be set to an error that occurs during
-///           transforming the value.
-///
-/// Returns the result of the transformation, which may be nil.
-typedef id _Nullable (^MTLAnyValueTransformerBlock)(_Nullable __kindof id value, BOOL *_Nonnull success, NSError *_Nullable *_Nullable error);
-
-//
-// Any MTLValueTransformer supporting reverse transformation. Necessary because
-// +allowsReverseTransformation is a class method.
-//
-@interface MTLReversibleValueTransformer : MTLValueTransformer
-@end
-
-@interface MTLValueTransformer ()
-
-@property (nonatomic, copy, readonly) MTLAnyValueTransformerBlock forwardBlock;
-@property (nonatomic, copy, readonly) MTLAnyValueTransformerBlock reverseBlock;
-
-@end
+#import "MTLValueTransformer_Private.h"
 
 @implementation MTLValueTransformer
 
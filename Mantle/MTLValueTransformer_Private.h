@@ -0,0 +1,49 @@
+//
+//  MTLValueTransformer_Private.h
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLValueTransformer.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A block that represents a transformation.
+///
+/// value   - The value to transform.
+/// success - The block must set this parameter to indicate whether the
+///           transformation was successful.
+///           MTLValueTransformer will always call this block with *success
+///           initialized to YES.
+/// error   - If not NULL, this may be set to an error that occurs during
+///           transforming the value.
+///
+/// Returns the result of the transformation, which may be nil.
+typedef id _Nullable (^MTLAnyValueTransformerBlock)(_Nullable __kindof id value, BOOL *_Nonnull success, NSError *_Nullable *_Nullable error);
+
+//
+// Any MTLValueTransformer supporting reverse transformation. Necessary because
+// +allowsReverseTransformation is a class method.
+//
+@interface MTLReversibleValueTransformer : MTLValueTransformer
+@end
+
+@interface MTLValueTransformer ()
+
+@property (nonatomic, copy, readonly) MTLAnyValueTransformerBlock forwardBlock;
+@property (nonatomic, copy, readonly, nullable) MTLAnyValueTransformerBlock reverseBlock;
+
+@end
+
+/// Returns the class checked by a transformer created with
+/// +mtl_validatingTransformerForClass:, or nil if `transformer` was created in
+/// any other way.
+///
+/// This allows MTLJSONAdapter to perform the check itself, instead of invoking
+/// the transformer for every value.
+MANTLE_PRIVATE
+Class _Nullable MTLValidatedClassForTransformer(NSValueTransformer * _Nullable transformer);
+
+NS_ASSUME_NONNULL_END
@@ -15,9 +15,17 @@ FOUNDATION_EXPORT double MantleVersionNumber;
 FOUNDATION_EXPORT const unsigned char MantleVersionString[];
 
 #import <Mantle/MTLJSONAdapter.h>
+#import <Mantle/MTLColumnarModelArray.h>
+#import <Mantle/MTLJSONDecodingLimits.h>
 #import <Mantle/MTLModel.h>
 #import <Mantle/MTLModel+NSCoding.h>
+#import <Mantle/MTLModel+Fingerprinting.h>
+#import <Mantle/MTLModel+Diffing.h>
+#import <Mantle/MTLModel+ChangeTracking.h>
 #import <Mantle/MTLValueTransformer.h>
+#import <Mantle/MTLIdentityMap.h>
+#import <Mantle/MTLInterningContext.h>
+#import <Mantle/MTLMemoizingValueTransformer.h>
 #import <Mantle/MTLTransformerErrorHandling.h>
 #import <Mantle/NSArray+MTLManipulationAdditions.h>
 #import <Mantle/NSDictionary+MTLManipulationAdditions.h>
@@ -24,6 +24,32 @@ extern NSString * const MTLURLValueTransformerName;
 /// proper boolean.
 extern NSString * const MTLBooleanValueTransformerName;
 
+/// The name for a value transformer that converts base64 strings into NSData
+/// and back.
+///
+/// Strings use the standard alphabet of RFC 4648. Padding is optional when
+/// decoding, and always written when encoding.
+extern NSString * const MTLBase64DataValueTransformerName;
+
+/// The name for a value transformer that converts base64 strings in the URL
+/// and filename safe alphabet of RFC 4648 into NSData and back.
+///
+/// Padding is optional when decoding, and never written when encoding.
+extern NSString * const MTLBase64URLDataValueTransformerName;
+
+/// The name for a value transformer that converts hexadecimal strings into
+/// NSData and back.
+///
+/// Either case is accepted when decoding. Lowercase is written when encoding.
+extern NSString * const MTLHexDataValueTransformerName;
+
+/// The name for a value transformer that converts UUID strings into NSUUIDs and
+/// back.
+///
+/// Either case is accepted when decoding. Lowercase is written when encoding,
+/// as recommended by RFC 4122.
+extern NSString * const MTLUUIDValueTransformerName;
+
 @interface NSValueTransformer (MTLPredefinedTransformerAdditions)
 
 /// An optionally reversible transformer which applies the given transformer to
@@ -37,6 +63,36 @@ extern NSString * const MTLBooleanValueTransformerName;
 /// array.
 + (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_arrayMappingTransformerWithTransformer:(NSValueTransformer *)transformer;
 
+/// A transformer which applies the given transformers one after another, passing
+/// the result of each to the next.
+///
+/// transformers - The transformers to chain, in the order of the forward
+///                transformation. If all of them are reversible, the transformer
+///                returned by this method will be reversible, and will reverse
+///                the chain in the opposite order, the same way
+///                -mtl_invertedTransformer would. Transformers which are
+///                themselves compositions are flattened into the chain. This
+///                argument must contain at least one transformer.
+///
+/// The chain runs as a single transformation with a single error path: if any
+/// transformer fails, the chain stops and reports that transformer's error.
+/// Every transformer is applied even if its input is nil, exactly as when
+/// chaining them by hand, so that transformers mapping nil to a default value
+/// keep working.
+///
+/// Can for example be used to parse an enum from a string containing a number.
+///
+///   NSValueTransformer *valueTransformer = [NSValueTransformer mtl_transformerByComposingTransformers:@[
+///     [NSValueTransformer mtl_numberTransformerWithNumberStyle:NSNumberFormatterDecimalStyle locale:nil],
+///     [NSValueTransformer mtl_valueMappingTransformerWithDictionary:@{
+///       @0: @(EnumDataTypeFoo),
+///       @1: @(EnumDataTypeBar),
+///     }],
+///   ]];
+///
+/// Returns a transformer which applies each of the given transformers in turn.
++ (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_transformerByComposingTransformers:(NSArray<NSValueTransformer *> *)transformers;
+
 /// A reversible value transformer to transform between the keys and objects of a
 /// dictionary.
 ///
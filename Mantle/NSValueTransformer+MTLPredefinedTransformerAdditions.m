@@ -6,13 +6,189 @@
 //  Copyright (c) 2012 GitHub. All rights reserved.
 //
 
+#import <objc/runtime.h>
+
 #import "NSValueTransformer+MTLPredefinedTransformerAdditions.h"
+#import "MTLByteEncoding.h"
 #import "MTLJSONAdapter.h"
 #import "MTLModel.h"
-#import "MTLValueTransformer.h"
+#import "MTLValueTransformer_Private.h"
 
 NSString * const MTLURLValueTransformerName = @"MTLURLValueTransformerName";
 NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerName";
+NSString * const MTLBase64DataValueTransformerName = @"MTLBase64DataValueTransformerName";
+NSString * const MTLBase64URLDataValueTransformerName = @"MTLBase64URLDataValueTransformerName";
+NSString * const MTLHexDataValueTransformerName = @"MTLHexDataValueTransformerName";
+NSString * const MTLUUIDValueTransformerName = @"MTLUUIDValueTransformerName";
+
+// Associated in +mtl_transformerByComposingTransformers: with the flattened
+// array of transformers applied by the returned transformer.
+static void *MTLComposedTransformersKey = &MTLComposedTransformersKey;
+
+// Associated in +mtl_validatingTransformerForClass: with the class checked by
+// the returned transformer.
+static void *MTLValidatedClassKey = &MTLValidatedClassKey;
+
+Class MTLValidatedClassForTransformer(NSValueTransformer *transformer) {
+	if (transformer == nil) return nil;
+
+	return objc_getAssociatedObject(transformer, MTLValidatedClassKey);
+}
+
+// Returns a block which performs the forward transformation of `transformer`.
+//
+// The block of an MTLValueTransformer is returned as is, so that composed
+// transformers don't have to go through the success and error bookkeeping of
+// each stage.
+static MTLAnyValueTransformerBlock MTLForwardBlockForTransformer(NSValueTransformer *transformer) {
+	SEL selector = @selector(transformedValue:success:error:);
+
+	if ([transformer isKindOfClass:MTLValueTransformer.class] && [transformer methodForSelector:selector] == [MTLValueTransformer instanceMethodForSelector:selector]) {
+		return ((MTLValueTransformer *)transformer).forwardBlock;
+	}
+
+	if ([transformer respondsToSelector:selector]) {
+		id<MTLTransformerErrorHandling> errorHandlingTransformer = (id)transformer;
+
+		return ^(id value, BOOL *success, NSError **error) {
+			return [errorHandlingTransformer transformedValue:value success:success error:error];
+		};
+	}
+
+	return ^(id value, BOOL *success, NSError **error) {
+		return [transformer transformedValue:value];
+	};
+}
+
+// Returns a block which performs the reverse transformation of `transformer`,
+// which must allow reverse transformation.
+//
+// See MTLForwardBlockForTransformer().
+static MTLAnyValueTransformerBlock MTLReverseBlockForTransformer(NSValueTransformer *transformer) {
+	SEL selector = @selector(reverseTransformedValue:success:error:);
+
+	if ([transformer isKindOfClass:MTLReversibleValueTransformer.class] && [transformer methodForSelector:selector] == [MTLReversibleValueTransformer instanceMethodForSelector:selector]) {
+		return ((MTLValueTransformer *)transformer).reverseBlock;
+	}
+
+	if ([transformer respondsToSelector:selector]) {
+		id<MTLTransformerErrorHandling> errorHandlingTransformer = (id)transformer;
+
+		return ^(id value, BOOL *success, NSError **error) {
+			return [errorHandlingTransformer reverseTransformedValue:value success:success error:error];
+		};
+	}
+
+	return ^(id value, BOOL *success, NSError **error) {
+		return [transformer reverseTransformedValue:value];
+	};
+}
+
+// Returns an error for an input value which could not be transformed.
+static NSError *MTLInvalidInputError(NSString *description, NSString *failureReason, id value) {
+	NSDictionary *userInfo = @{
+		NSLocalizedDescriptionKey: description,
+		NSLocalizedFailureReasonErrorKey: failureReason,
+		MTLTransformerErrorHandlingInputValueErrorKey: value
+	};
+
+	return [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+}
+
+// Returns the UTF-8 representation of `string`, avoiding a copy if the string
+// already stores its characters that way.
+//
+// length - Set to the number of bytes in the returned buffer, which is valid
+//          for as long as `string` is.
+static const char *MTLUTF8BytesOfString(NSString *string, size_t *length) {
+	const char *bytes = CFStringGetCStringPtr((__bridge CFStringRef)string, kCFStringEncodingUTF8) ?: string.UTF8String;
+
+	*length = (bytes != NULL ? [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding] : 0);
+	return bytes;
+}
+
+// Returns a transformer between strings and the data they encode.
+//
+// description   - The description of errors from forward transformations.
+// name          - The name of the encoding, as used in error messages.
+// maximumLength - Returns the maximum number of bytes decoded from a number of
+//                 characters, or SIZE_MAX if that many characters can't be
+//                 decoded.
+// decode        - Decodes characters into a buffer of the maximum length,
+//                 returning the number of bytes written, or SIZE_MAX if the
+//                 characters were malformed.
+// encodedLength - Returns the number of characters encoding a number of bytes.
+// encode        - Encodes bytes into a buffer of the encoded length.
+static MTLValueTransformer *MTLDataTransformer(NSString *description, NSString *name, size_t (^maximumLength)(size_t length), size_t (^decode)(const char *characters, size_t length, uint8_t *bytes), size_t (^encodedLength)(size_t length), void (^encode)(const uint8_t *bytes, size_t length, char *characters)) {
+	return [MTLValueTransformer
+		transformerUsingForwardBlock:^ id (NSString *string, BOOL *success, NSError **error) {
+			if (string == nil) return nil;
+
+			if (![string isKindOfClass:NSString.class]) {
+				if (error != NULL) {
+					*error = MTLInvalidInputError(description, [NSString stringWithFormat:NSLocalizedString(@"Expected an NSString, got: %@.", @""), string], string);
+				}
+				*success = NO;
+				return nil;
+			}
+
+			size_t length = 0;
+			const char *characters = MTLUTF8BytesOfString(string, &length);
+			size_t capacity = (characters != NULL ? maximumLength(length) : SIZE_MAX);
+
+			uint8_t *bytes = (capacity != SIZE_MAX ? malloc(MAX(capacity, 1)) : NULL);
+			size_t decodedLength = (bytes != NULL ? decode(characters, length, bytes) : SIZE_MAX);
+
+			if (decodedLength == SIZE_MAX) {
+				free(bytes);
+
+				if (error != NULL) {
+					*error = MTLInvalidInputError(description, [NSString stringWithFormat:NSLocalizedString(@"Input %@ string %@ was malformed", @""), name, string], string);
+				}
+				*success = NO;
+				return nil;
+			}
+
+			return [NSData dataWithBytesNoCopy:bytes length:decodedLength freeWhenDone:YES];
+		}
+		reverseBlock:^ id (NSData *data, BOOL *success, NSError **error) {
+			if (data == nil) return nil;
+
+			if (![data isKindOfClass:NSData.class]) {
+				if (error != NULL) {
+					NSString *reverseDescription = [NSString stringWithFormat:NSLocalizedString(@"Could not convert data to %@ string", @""), name];
+					*error = MTLInvalidInputError(reverseDescription, [NSString stringWithFormat:NSLocalizedString(@"Expected an NSData, got: %@.", @""), data], data);
+				}
+				*success = NO;
+				return nil;
+			}
+
+			size_t length = encodedLength(data.length);
+			char *characters = malloc(MAX(length, 1));
+			encode(data.bytes, data.length, characters);
+
+			return [[NSString alloc] initWithBytesNoCopy:characters length:length encoding:NSASCIIStringEncoding freeWhenDone:YES];
+		}];
+}
+
+// Returns a transformer between base64 strings in the given alphabet and the
+// data they encode.
+static MTLValueTransformer *MTLBase64DataTransformer(MTLBase64Alphabet alphabet) {
+	return MTLDataTransformer(NSLocalizedString(@"Could not convert base64 string to data", @""), @"base64",
+		^(size_t length) {
+			return MTLBase64MaximumDecodedLength(length);
+		},
+		^(const char *characters, size_t length, uint8_t *bytes) {
+			size_t decodedLength = 0;
+			return (MTLBase64Decode(characters, length, bytes, &decodedLength, alphabet) ? decodedLength : SIZE_MAX);
+		},
+		^(size_t length) {
+			return MTLBase64EncodedLength(length, alphabet);
+		},
+		^(const uint8_t *bytes, size_t length, char *characters) {
+			MTLBase64Encode(bytes, length, characters, alphabet);
+		});
+}
 
 @implementation NSValueTransformer (MTLPredefinedTransformerAdditions)
 
@@ -98,6 +274,73 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 			}];
 
 		[NSValueTransformer setValueTransformer:booleanValueTransformer forName:MTLBooleanValueTransformerName];
+
+		[NSValueTransformer setValueTransformer:MTLBase64DataTransformer(MTLBase64AlphabetStandard) forName:MTLBase64DataValueTransformerName];
+		[NSValueTransformer setValueTransformer:MTLBase64DataTransformer(MTLBase64AlphabetURL) forName:MTLBase64URLDataValueTransformerName];
+
+		MTLValueTransformer *hexDataValueTransformer = MTLDataTransformer(NSLocalizedString(@"Could not convert hexadecimal string to data", @""), @"hexadecimal",
+			^(size_t length) {
+				return (length % 2 == 0 ? length / 2 : SIZE_MAX);
+			},
+			^(const char *characters, size_t length, uint8_t *bytes) {
+				return (MTLHexDecode(characters, length, bytes) ? length / 2 : SIZE_MAX);
+			},
+			^(size_t length) {
+				return length * 2;
+			},
+			^(const uint8_t *bytes, size_t length, char *characters) {
+				MTLHexEncode(bytes, length, characters);
+			});
+
+		[NSValueTransformer setValueTransformer:hexDataValueTransformer forName:MTLHexDataValueTransformerName];
+
+		MTLValueTransformer *UUIDValueTransformer = [MTLValueTransformer
+			transformerUsingForwardBlock:^ id (NSString *str, BOOL *success, NSError **error) {
+				if (str == nil) return nil;
+
+				if (![str isKindOfClass:NSString.class]) {
+					if (error != NULL) {
+						*error = MTLInvalidInputError(NSLocalizedString(@"Could not convert string to UUID", @""), [NSString stringWithFormat:NSLocalizedString(@"Expected an NSString, got: %@.", @""), str], str);
+					}
+					*success = NO;
+					return nil;
+				}
+
+				size_t length = 0;
+				const char *characters = MTLUTF8BytesOfString(str, &length);
+
+				uuid_t bytes;
+				if (characters == NULL || !MTLUUIDDecode(characters, length, bytes)) {
+					if (error != NULL) {
+						*error = MTLInvalidInputError(NSLocalizedString(@"Could not convert string to UUID", @""), [NSString stringWithFormat:NSLocalizedString(@"Input UUID string %@ was malformed", @""), str], str);
+					}
+					*success = NO;
+					return nil;
+				}
+
+				return [[NSUUID alloc] initWithUUIDBytes:bytes];
+			}
+			reverseBlock:^ id (NSUUID *UUID, BOOL *success, NSError **error) {
+				if (UUID == nil) return nil;
+
+				if (![UUID isKindOfClass:NSUUID.class]) {
+					if (error != NULL) {
+						*error = MTLInvalidInputError(NSLocalizedString(@"Could not convert UUID to string", @""), [NSString stringWithFormat:NSLocalizedString(@"Expected an NSUUID, got: %@.", @""), UUID], UUID);
+					}
+					*success = NO;
+					return nil;
+				}
+
+				uuid_t bytes;
+				[UUID getUUIDBytes:bytes];
+
+				char characters[MTLUUIDStringLength];
+				MTLUUIDEncode(bytes, characters);
+
+				return [[NSString alloc] initWithBytes:characters length:MTLUUIDStringLength encoding:NSASCIIStringEncoding];
+			}];
+
+		[NSValueTransformer setValueTransformer:UUIDValueTransformer forName:MTLUUIDValueTransformerName];
 	}
 }
 
@@ -228,10 +471,69 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 	}
 }
 
++ (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_transformerByComposingTransformers:(NSArray *)transformers {
+	NSParameterAssert(transformers.count > 0);
+
+	NSMutableArray *flattenedTransformers = [NSMutableArray arrayWithCapacity:transformers.count];
+	for (NSValueTransformer *transformer in transformers) {
+		NSArray *composedTransformers = objc_getAssociatedObject(transformer, MTLComposedTransformersKey);
+
+		if (composedTransformers != nil) {
+			[flattenedTransformers addObjectsFromArray:composedTransformers];
+		} else {
+			[flattenedTransformers addObject:transformer];
+		}
+	}
+
+	NSMutableArray *forwardBlocks = [NSMutableArray arrayWithCapacity:flattenedTransformers.count];
+	NSMutableArray *reverseBlocks = [NSMutableArray arrayWithCapacity:flattenedTransformers.count];
+	BOOL reversible = YES;
+
+	for (NSValueTransformer *transformer in flattenedTransformers) {
+		[forwardBlocks addObject:MTLForwardBlockForTransformer(transformer)];
+
+		if (!transformer.class.allowsReverseTransformation) {
+			reversible = NO;
+			continue;
+		}
+
+		[reverseBlocks insertObject:MTLReverseBlockForTransformer(transformer) atIndex:0];
+	}
+
+	id (^forwardBlock)(id value, BOOL *success, NSError **error) = ^ id (id value, BOOL *success, NSError **error) {
+		for (MTLAnyValueTransformerBlock block in forwardBlocks) {
+			value = block(value, success, error);
+			if (*success == NO) return nil;
+		}
+
+		return value;
+	};
+
+	MTLValueTransformer *result = nil;
+	if (reversible) {
+		result = [MTLValueTransformer
+			transformerUsingForwardBlock:forwardBlock
+			reverseBlock:^ id (id value, BOOL *success, NSError **error) {
+				for (MTLAnyValueTransformerBlock block in reverseBlocks) {
+					value = block(value, success, error);
+					if (*success == NO) return nil;
+				}
+
+				return value;
+			}];
+	} else {
+		result = [MTLValueTransformer transformerUsingForwardBlock:forwardBlock];
+	}
+
+	objc_setAssociatedObject(result, MTLComposedTransformersKey, flattenedTransformers, OBJC_ASSOCIATION_COPY_NONATOMIC);
+
+	return result;
+}
+
 + (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_validatingTransformerForClass:(Class)modelClass {
 	NSParameterAssert(modelClass != nil);
 
-	return [MTLValueTransformer transformerUsingForwardBlock:^ id (id value, BOOL *success, NSError **error) {
+	MTLValueTransformer *transformer = [MTLValueTransformer transformerUsingForwardBlock:^ id (id value, BOOL *success, NSError **error) {
 		if (value != nil && ![value isKindOfClass:modelClass]) {
 			if (error != NULL) {
 				NSDictionary *userInfo = @{
@@ -248,6 +550,10 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 
 		return value;
 	}];
+
+	objc_setAssociatedObject(transformer, MTLValidatedClassKey, modelClass, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+
+	return transformer;
 }
 
 + (NSValueTransformer *)mtl_valueMappingTransformerWithDictionary:(NSDictionary *)dictionary defaultValue:(id)defaultValue reverseDefaultValue:(id)reverseDefaultValue {
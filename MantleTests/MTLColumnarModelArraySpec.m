@@ -0,0 +1,126 @@
+//
+//  MTLColumnarModelArraySpec.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLColumnarModelArraySpec)
+
+__block MTLJSONAdapter *adapter;
+__block NSArray *JSONArray;
+
+beforeEach(^{
+	adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+
+	JSONArray = @[
+		@{ @"username": @"foo", @"count": @"5", @"nested": @{ @"name": @"bar" } },
+		@{ @"username": NSNull.null, @"count": @"7" },
+	];
+});
+
+it(@"should store the properties of all models", ^{
+	NSError *error = nil;
+	MTLColumnarModelArray *modelArray = [adapter columnarModelArrayFromJSONArray:JSONArray fieldMask:nil error:&error];
+	expect(modelArray).notTo(beNil());
+	expect(error).to(beNil());
+
+	expect(modelArray.modelClass).to(equal(MTLTestModel.class));
+	expect(@(modelArray.count)).to(equal(@2));
+	expect(modelArray.propertyKeys).to(equal(@[ @"count", @"name", @"nestedName" ]));
+
+	expect([modelArray valueForPropertyKey:@"name" atIndex:0]).to(equal(@"foo"));
+	expect([modelArray valueForPropertyKey:@"name" atIndex:1]).to(beNil());
+	expect([modelArray valueForPropertyKey:@"nestedName" atIndex:0]).to(equal(@"bar"));
+	expect([modelArray valueForPropertyKey:@"count" atIndex:1]).to(equal(@7));
+});
+
+it(@"should store scalar properties as C arrays", ^{
+	MTLColumnarModelArray *modelArray = [adapter columnarModelArrayFromJSONArray:JSONArray fieldMask:nil error:NULL];
+
+	expect(@(strcmp([modelArray objCTypeOfColumnForPropertyKey:@"count"], @encode(NSUInteger)))).to(equal(@0));
+
+	const NSUInteger *counts = [modelArray bytesOfColumnForPropertyKey:@"count"];
+	expect(@(counts[0])).to(equal(@5));
+	expect(@(counts[1])).to(equal(@7));
+});
+
+it(@"should store object properties as arrays of objects", ^{
+	MTLColumnarModelArray *modelArray = [adapter columnarModelArrayFromJSONArray:JSONArray fieldMask:nil error:NULL];
+
+	expect(@(strcmp([modelArray objCTypeOfColumnForPropertyKey:@"name"], @encode(id)))).to(equal(@0));
+	expect([NSValue valueWithPointer:[modelArray bytesOfColumnForPropertyKey:@"name"]]).to(equal([NSValue valueWithPointer:NULL]));
+
+	expect([modelArray objectsOfColumnForPropertyKey:@"name"]).to(equal(@[ @"foo", NSNull.null ]));
+	expect([modelArray objectsOfColumnForPropertyKey:@"count"]).to(equal(@[ @5, @7 ]));
+});
+
+it(@"should return views of single models", ^{
+	MTLColumnarModelArray *modelArray = [adapter columnarModelArrayFromJSONArray:JSONArray fieldMask:nil error:NULL];
+
+	MTLColumnarModelRow *row = modelArray[0];
+	expect(@(row.index)).to(equal(@0));
+	expect(row[@"name"]).to(equal(@"foo"));
+	expect([row valueForKey:@"count"]).to(equal(@5));
+});
+
+it(@"should create the same models as decoding them one by one", ^{
+	MTLColumnarModelArray *modelArray = [adapter columnarModelArrayFromJSONArray:JSONArray fieldMask:nil error:NULL];
+
+	for (NSUInteger index = 0; index < JSONArray.count; index++) {
+		MTLTestModel *expected = [adapter modelFromJSONDictionary:JSONArray[index] error:NULL];
+
+		NSError *error = nil;
+		MTLTestModel *model = [modelArray modelAtIndex:index error:&error];
+		expect(model).to(equal(expected));
+		expect(error).to(beNil());
+
+		expect([modelArray[index] modelWithError:NULL]).to(equal(expected));
+	}
+});
+
+it(@"should validate models when they are created", ^{
+	MTLColumnarModelArray *modelArray = [adapter columnarModelArrayFromJSONArray:@[ @{ @"username": @"this is too long a name" } ] fieldMask:nil error:NULL];
+	expect(modelArray).notTo(beNil());
+
+	NSError *error = nil;
+	expect([modelArray modelAtIndex:0 error:&error]).to(beNil());
+	expect(error.domain).to(equal(MTLTestModelErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLTestModelNameTooLong)));
+});
+
+it(@"should not validate models of arrays decoded with a field mask", ^{
+	MTLJSONAdapter *validationAdapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLValidationModel.class];
+
+	MTLColumnarModelArray *modelArray = [validationAdapter columnarModelArrayFromJSONArray:@[ @{} ] fieldMask:nil error:NULL];
+	expect([modelArray modelAtIndex:0 error:NULL]).to(beNil());
+
+	MTLColumnarModelArray *maskedModelArray = [validationAdapter columnarModelArrayFromJSONArray:@[ @{} ] fieldMask:[NSSet set] error:NULL];
+
+	NSError *error = nil;
+	expect([maskedModelArray modelAtIndex:0 error:&error]).notTo(beNil());
+	expect(error).to(beNil());
+});
+
+it(@"should only store the properties in a field mask", ^{
+	MTLColumnarModelArray *modelArray = [adapter columnarModelArrayFromJSONArray:JSONArray fieldMask:[NSSet setWithObject:@"name"] error:NULL];
+
+	expect(modelArray.propertyKeys).to(equal(@[ @"name" ]));
+	expect([modelArray valueForPropertyKey:@"name" atIndex:0]).to(equal(@"foo"));
+});
+
+it(@"should return an error for elements which are not dictionaries", ^{
+	NSError *error = nil;
+	expect([adapter columnarModelArrayFromJSONArray:@[ @{}, @"foo" ] fieldMask:nil error:&error]).to(beNil());
+	expect(error.domain).to(equal(MTLJSONAdapterErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorInvalidJSONDictionary)));
+});
+
+QuickSpecEnd
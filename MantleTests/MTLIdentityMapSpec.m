@@ -0,0 +1,177 @@
+//
+//  MTLIdentityMapSpec.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLIdentityMapSpec)
+
+__block MTLIdentityMap *identityMap;
+__block MTLJSONAdapter *adapter;
+
+beforeEach(^{
+	identityMap = [[MTLIdentityMap alloc] init];
+
+	adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLIdentityTestModel.class];
+	adapter.identityMap = identityMap;
+});
+
+it(@"should update the model decoded before for the same primary key", ^{
+	MTLIdentityTestModel *model = [adapter modelFromJSONDictionary:@{ @"id": @"1", @"name": @"foo" } error:NULL];
+	expect(model).notTo(beNil());
+
+	MTLIdentityTestModel *updatedModel = [adapter modelFromJSONDictionary:@{ @"id": @"1", @"name": @"bar" } error:NULL];
+	expect(updatedModel).to(beIdenticalTo(model));
+	expect(model.name).to(equal(@"bar"));
+
+	expect([identityMap modelOfClass:MTLIdentityTestModel.class forPrimaryKey:@"1"]).to(beIdenticalTo(model));
+});
+
+it(@"should keep values missing from a partial payload", ^{
+	MTLIdentityTestModel *model = [adapter modelFromJSONDictionary:@{ @"id": @"1", @"name": @"foo" } error:NULL];
+	MTLIdentityTestModel *updatedModel = [adapter modelFromJSONDictionary:@{ @"id": @"1" } error:NULL];
+
+	expect(updatedModel).to(beIdenticalTo(model));
+	expect(model.name).to(equal(@"foo"));
+});
+
+it(@"should only merge the given property keys", ^{
+	MTLIdentityTestModel *model = [MTLIdentityTestModel modelWithDictionary:@{ @"identifier": @"1", @"name": @"foo" } error:NULL];
+	MTLIdentityTestModel *otherModel = [MTLIdentityTestModel modelWithDictionary:@{ @"identifier": @"1", @"name": @"bar", @"friends": @[] } error:NULL];
+
+	expect([identityMap upsertModel:model forPrimaryKey:@"1"]).to(beIdenticalTo(model));
+	expect([identityMap upsertModel:otherModel forPrimaryKey:@"1" propertyKeys:[NSSet setWithObject:@"friends"]]).to(beIdenticalTo(model));
+	expect(model.name).to(equal(@"foo"));
+	expect(model.friends).to(equal(@[]));
+});
+
+it(@"should only update the properties decoded with a field mask", ^{
+	NSSet *fieldMask = [NSSet setWithObjects:@"identifier", @"friends", nil];
+
+	for (NSNumber *decodesIteratively in @[ @NO, @YES ]) {
+		adapter.decodesIteratively = decodesIteratively.boolValue;
+
+		MTLIdentityTestModel *model = [adapter modelFromJSONDictionary:@{ @"id": @"1", @"name": @"foo" } error:NULL];
+		MTLIdentityTestModel *updatedModel = [adapter modelFromJSONDictionary:@{ @"id": @"1", @"name": @"bar", @"friends": @[] } fieldMask:fieldMask error:NULL];
+
+		expect(updatedModel).to(beIdenticalTo(model));
+		expect(model.name).to(equal(@"foo"));
+		expect(model.friends).to(equal(@[]));
+
+		[identityMap removeAllModels];
+	}
+});
+
+it(@"should keep models with different primary keys apart", ^{
+	MTLIdentityTestModel *model = [adapter modelFromJSONDictionary:@{ @"id": @"1", @"name": @"foo" } error:NULL];
+	MTLIdentityTestModel *otherModel = [adapter modelFromJSONDictionary:@{ @"id": @"2", @"name": @"bar" } error:NULL];
+
+	expect(otherModel).notTo(beIdenticalTo(model));
+	expect(model.name).to(equal(@"foo"));
+	expect([identityMap modelOfClass:MTLTestModel.class forPrimaryKey:@"1"]).to(beNil());
+});
+
+it(@"should return models without a primary key as they are", ^{
+	MTLIdentityTestModel *model = [adapter modelFromJSONDictionary:@{ @"name": @"foo" } error:NULL];
+	MTLIdentityTestModel *otherModel = [adapter modelFromJSONDictionary:@{ @"name": @"foo" } error:NULL];
+
+	expect(otherModel).notTo(beIdenticalTo(model));
+});
+
+it(@"should update nested models", ^{
+	MTLIdentityTestModel *friend = [adapter modelFromJSONDictionary:@{ @"id": @"2", @"name": @"bar" } error:NULL];
+
+	MTLIdentityTestModel *model = [adapter modelFromJSONDictionary:@{
+		@"id": @"1",
+		@"friends": @[ @{ @"id": @"2", @"name": @"baz" } ]
+	} error:NULL];
+
+	expect(model.friends[0]).to(beIdenticalTo(friend));
+	expect(friend.name).to(equal(@"baz"));
+});
+
+it(@"should only reference models weakly by default", ^{
+	__weak MTLIdentityTestModel *weakModel;
+
+	@autoreleasepool {
+		weakModel = [adapter modelFromJSONDictionary:@{ @"id": @"1", @"name": @"foo" } error:NULL];
+	}
+
+	expect(weakModel).to(beNil());
+	expect([identityMap modelOfClass:MTLIdentityTestModel.class forPrimaryKey:@"1"]).to(beNil());
+});
+
+it(@"should keep recently upserted models alive with a count limit", ^{
+	adapter.identityMap = [[MTLIdentityMap alloc] initWithCountLimit:8];
+
+	__weak MTLIdentityTestModel *weakModel;
+
+	@autoreleasepool {
+		weakModel = [adapter modelFromJSONDictionary:@{ @"id": @"1", @"name": @"foo" } error:NULL];
+	}
+
+	expect(weakModel).notTo(beNil());
+	expect([adapter.identityMap modelOfClass:MTLIdentityTestModel.class forPrimaryKey:@"1"]).to(beIdenticalTo(weakModel));
+});
+
+it(@"should replace immutable models that changed", ^{
+	MTLImmutableTestModel *model = [MTLImmutableTestModel modelWithDictionary:@{ @"firstName": @"foo" } error:NULL];
+	MTLImmutableTestModel *equalModel = [MTLImmutableTestModel modelWithDictionary:@{ @"firstName": @"foo" } error:NULL];
+	MTLImmutableTestModel *changedModel = [MTLImmutableTestModel modelWithDictionary:@{ @"firstName": @"bar" } error:NULL];
+
+	expect([identityMap upsertModel:model forPrimaryKey:@1]).to(beIdenticalTo(model));
+	expect([identityMap upsertModel:equalModel forPrimaryKey:@1]).to(beIdenticalTo(model));
+	expect([identityMap upsertModel:changedModel forPrimaryKey:@1]).to(beIdenticalTo(changedModel));
+	expect(model.firstName).to(equal(@"foo"));
+});
+
+it(@"should merge partial immutable models into a new model", ^{
+	MTLImmutableTestModel *model = [MTLImmutableTestModel modelWithDictionary:@{ @"firstName": @"foo", @"lastName": @"bar", @"count": @1 } error:NULL];
+	MTLImmutableTestModel *partialModel = [MTLImmutableTestModel modelWithDictionary:@{ @"firstName": @"baz" } error:NULL];
+	NSSet *propertyKeys = [NSSet setWithObjects:@"firstName", @"lastName", nil];
+
+	expect([identityMap upsertModel:model forPrimaryKey:@1]).to(beIdenticalTo(model));
+
+	MTLImmutableTestModel *mergedModel = [identityMap upsertModel:partialModel forPrimaryKey:@1 propertyKeys:propertyKeys];
+	expect(mergedModel).notTo(beIdenticalTo(model));
+	expect(mergedModel).notTo(beIdenticalTo(partialModel));
+	expect(mergedModel.firstName).to(equal(@"baz"));
+	expect(mergedModel.lastName).to(equal(@"bar"));
+	expect(@(mergedModel.count)).to(equal(@1));
+
+	expect([identityMap modelOfClass:MTLImmutableTestModel.class forPrimaryKey:@1]).to(beIdenticalTo(mergedModel));
+	expect([identityMap upsertModel:partialModel forPrimaryKey:@1 propertyKeys:propertyKeys]).to(beIdenticalTo(mergedModel));
+	expect(model.firstName).to(equal(@"foo"));
+});
+
+it(@"should merge models upserted from several threads one after the other", ^{
+	MTLIdentityTestModel *model = [MTLIdentityTestModel modelWithDictionary:@{ @"identifier": @"1" } error:NULL];
+	[identityMap upsertModel:model forPrimaryKey:@"1"];
+
+	dispatch_apply(100, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t index) {
+		NSString *name = [NSString stringWithFormat:@"name %zu", index];
+		MTLIdentityTestModel *otherModel = [MTLIdentityTestModel modelWithDictionary:@{ @"identifier": @"1", @"name": name, @"friends": @[ name ] } error:NULL];
+
+		[identityMap upsertModel:otherModel forPrimaryKey:@"1"];
+	});
+
+	// Both properties come from the same upsert.
+	expect(model.friends).to(equal(@[ model.name ]));
+});
+
+it(@"should forget all models", ^{
+	MTLIdentityTestModel *model = [adapter modelFromJSONDictionary:@{ @"id": @"1", @"name": @"foo" } error:NULL];
+	[identityMap removeAllModels];
+
+	expect([adapter modelFromJSONDictionary:@{ @"id": @"1", @"name": @"foo" } error:NULL]).notTo(beIdenticalTo(model));
+});
+
+QuickSpecEnd
@@ -0,0 +1,101 @@
+//
+//  MTLInterningContextSpec.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLInterningContextSpec)
+
+__block MTLInterningContext *context;
+
+beforeEach(^{
+	context = [[MTLInterningContext alloc] init];
+});
+
+it(@"should return the first of equal immutable models", ^{
+	MTLImmutableTestModel *model = [MTLImmutableTestModel modelWithDictionary:@{ @"firstName": @"foo" } error:NULL];
+	MTLImmutableTestModel *equalModel = [MTLImmutableTestModel modelWithDictionary:@{ @"firstName": @"foo" } error:NULL];
+	MTLImmutableTestModel *otherModel = [MTLImmutableTestModel modelWithDictionary:@{ @"firstName": @"bar" } error:NULL];
+
+	expect([context internModel:model]).to(beIdenticalTo(model));
+	expect([context internModel:equalModel]).to(beIdenticalTo(model));
+	expect([context internModel:otherModel]).to(beIdenticalTo(otherModel));
+	expect([context internModel:model]).to(beIdenticalTo(model));
+
+	expect(@(context.modelCount)).to(equal(@2));
+	expect(@(context.internedModelCount)).to(equal(@1));
+	expect(@(context.savedByteCount)).to(beGreaterThan(@0));
+});
+
+it(@"should not intern mutable models or other objects", ^{
+	MTLTestModel *model = [MTLTestModel modelWithDictionary:@{ @"name": @"foo" } error:NULL];
+	MTLTestModel *equalModel = [MTLTestModel modelWithDictionary:@{ @"name": @"foo" } error:NULL];
+
+	expect([context internModel:model]).to(beIdenticalTo(model));
+	expect([context internModel:equalModel]).to(beIdenticalTo(equalModel));
+	expect([context internModel:@"foo"]).to(equal(@"foo"));
+
+	expect(@(context.modelCount)).to(equal(@0));
+	expect(@(context.internedModelCount)).to(equal(@0));
+});
+
+describe(@"with a JSON adapter", ^{
+	NSDictionary *owner = @{ @"firstName": @"foo", @"lastName": @"bar", @"count": @1, @"ratio": @0.5 };
+	NSDictionary *JSONDictionary = @{
+		@"owner": owner,
+		@"members": @[ owner, @{ @"firstName": @"baz", @"count": @2 }, owner ]
+	};
+
+	it(@"should share nested models", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLInterningTestModel.class];
+		adapter.interningContext = context;
+
+		NSError *error = nil;
+		MTLInterningTestModel *model = [adapter modelFromJSONDictionary:JSONDictionary error:&error];
+		expect(model).notTo(beNil());
+		expect(error).to(beNil());
+
+		expect(model.members[0]).to(beIdenticalTo(model.owner));
+		expect(model.members[2]).to(beIdenticalTo(model.owner));
+		expect(model.members[1]).notTo(equal(model.owner));
+
+		expect(@(context.internedModelCount)).to(equal(@2));
+		expect(@(context.savedByteCount)).to(beGreaterThan(@0));
+	});
+
+	it(@"should share models between decodes", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLImmutableTestModel.class];
+		adapter.interningContext = context;
+
+		MTLImmutableTestModel *model = [adapter modelFromJSONDictionary:owner error:NULL];
+		expect([adapter modelFromJSONDictionary:owner error:NULL]).to(beIdenticalTo(model));
+	});
+
+	it(@"should not share models without a context", ^{
+		MTLInterningTestModel *model = [MTLJSONAdapter modelOfClass:MTLInterningTestModel.class fromJSONDictionary:JSONDictionary error:NULL];
+		expect(model).notTo(beNil());
+
+		expect(model.members[0]).to(equal(model.owner));
+		expect(model.members[0]).notTo(beIdenticalTo(model.owner));
+	});
+
+	it(@"should only use the context while the adapter is decoding", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLImmutableTestModel.class];
+		adapter.interningContext = context;
+		[adapter modelFromJSONDictionary:owner error:NULL];
+
+		MTLInterningTestModel *model = [MTLJSONAdapter modelOfClass:MTLInterningTestModel.class fromJSONDictionary:JSONDictionary error:NULL];
+		expect(model.members[0]).notTo(beIdenticalTo(model.owner));
+		expect(@(context.modelCount)).to(equal(@1));
+	});
+});
+
+QuickSpecEnd
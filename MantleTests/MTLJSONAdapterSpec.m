@@ -9,6 +9,7 @@
 #import <Mantle/Mantle.h>
 #import <Nimble/Nimble.h>
 #import <Quick/Quick.h>
+#import <pthread.h>
 
 #import "MTLTestJSONAdapter.h"
 #import "MTLTestModel.h"
@@ -29,6 +30,29 @@
 
 @end
 
+// Runs a block passed with __bridge_retained on a pthread.
+static void *MTLRunBlock(void *context) {
+	void (^block)(void) = (__bridge_transfer id)context;
+	block();
+
+	return NULL;
+}
+
+// Returns the JSON of a user which is a member of a group with another user,
+// and so on, `depth` times.
+static NSDictionary *MTLNestedUserJSONDictionary(NSUInteger depth, id leaf) {
+	id user = leaf;
+
+	for (NSUInteger i = 0; i < depth; i++) {
+		user = @{
+			@"name": [NSString stringWithFormat:@"user %lu", (unsigned long)i],
+			@"groups": @[ @{ @"users": @[ user ] } ],
+		};
+	}
+
+	return user;
+}
+
 QuickSpecBegin(MTLJSONAdapterSpec)
 
 it(@"should initialize with a model class", ^{
@@ -226,6 +250,26 @@ it(@"should implicitly transform BOOLs", ^{
 	expect(error).to(beNil());
 });
 
+it(@"should implicitly transform numbers into BOOLs", ^{
+	NSError *error = nil;
+	MTLBoolModel *model = [MTLJSONAdapter modelOfClass:MTLBoolModel.class fromJSONDictionary:@{ @"flag": @1 } error:&error];
+
+	expect(model).notTo(beNil());
+	expect(@(model.flag)).to(beTruthy());
+	expect(error).to(beNil());
+
+	expect([MTLJSONAdapter JSONDictionaryFromModel:model error:&error][@"flag"]).to(beIdenticalTo((id)kCFBooleanTrue));
+	expect(error).to(beNil());
+});
+
+it(@"should pass through values matching the type of their property", ^{
+	NSError *error = nil;
+	MTLStringModel *model = [MTLJSONAdapter modelOfClass:MTLStringModel.class fromJSONDictionary:@{ @"string": @"foo" } error:&error];
+
+	expect(model.string).to(equal(@"foo"));
+	expect(error).to(beNil());
+});
+
 it(@"should not invoke implicit transformers for property keys not actually backed by properties", ^{
 	MTLNonPropertyModel *model = [[MTLNonPropertyModel alloc] init];
 
@@ -502,6 +546,165 @@ describe(@"JSON transformers", ^{
 		});
 	});
 
+	describe(@"filtered array transformer", ^{
+		__block NSValueTransformer<MTLTransformerErrorHandling> *transformer;
+
+		beforeEach(^{
+			transformer = [MTLJSONAdapter arrayTransformerWithModelClass:MTLTestModel.class matchingPredicate:[NSPredicate predicateWithFormat:@"count == '2'"]];
+			expect(transformer).notTo(beNil());
+		});
+
+		it(@"should only transform JSON dictionaries matching the predicate", ^{
+			NSArray *JSONDictionaries = @[
+				@{ @"username": @"foo", @"count": @"1" },
+				NSNull.null,
+				@{ @"username": @"bar", @"count": @"2" },
+			];
+
+			NSArray *models = [transformer transformedValue:JSONDictionaries];
+			expect(@(models.count)).to(equal(@1));
+			expect([models[0] name]).to(equal(@"bar"));
+		});
+
+		it(@"should not decode JSON dictionaries which don't match", ^{
+			NSArray *JSONDictionaries = @[
+				@{ @"username": @"this is too long", @"count": @"1" },
+			];
+
+			BOOL success = NO;
+			NSError *error = nil;
+			NSArray *models = [transformer transformedValue:JSONDictionaries success:&success error:&error];
+			expect(@(success)).to(beTruthy());
+			expect(error).to(beNil());
+			expect(models).to(equal(@[]));
+		});
+
+		it(@"should not filter reverse transformations", ^{
+			MTLTestModel *model = [MTLTestModel modelWithDictionary:@{ @"count": @1 } error:NULL];
+
+			NSArray *JSONDictionaries = [transformer reverseTransformedValue:@[ model ]];
+			expect(@(JSONDictionaries.count)).to(equal(@1));
+		});
+	});
+
+	describe(@"keyed array transformer", ^{
+		__block NSValueTransformer *transformer;
+
+		__block NSDictionary *modelsByCount;
+		__block NSArray *JSONDictionaries;
+
+		beforeEach(^{
+			NSMutableDictionary *mutableModels = [NSMutableDictionary dictionary];
+			NSMutableArray *mutableDictionaries = [NSMutableArray array];
+
+			for (NSUInteger i = 0; i < 10; i++) {
+				MTLTestModel *model = [[MTLTestModel alloc] init];
+				model.count = i;
+
+				mutableModels[@(i)] = model;
+
+				NSDictionary *dict = [MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+				expect(dict).notTo(beNil());
+
+				[mutableDictionaries addObject:dict];
+			}
+
+			modelsByCount = [mutableModels copy];
+			JSONDictionaries = [mutableDictionaries copy];
+
+			transformer = [MTLJSONAdapter arrayTransformerWithModelClass:MTLTestModel.class keyedByPropertyKey:@"count"];
+			expect(transformer).notTo(beNil());
+		});
+
+		it(@"should transform JSON dictionaries into models keyed by a property", ^{
+			expect([transformer transformedValue:JSONDictionaries]).to(equal(modelsByCount));
+		});
+
+		it(@"should skip NSNull elements", ^{
+			NSArray *input = [JSONDictionaries arrayByAddingObject:NSNull.null];
+
+			expect([transformer transformedValue:input]).to(equal(modelsByCount));
+		});
+
+		it(@"should fail on duplicate keys", ^{
+			MTLTestModel *model = [[MTLTestModel alloc] init];
+			model.count = 3;
+			model.name = @"last";
+
+			NSDictionary *dict = [MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+			NSArray *input = [JSONDictionaries arrayByAddingObject:dict];
+
+			BOOL success = YES;
+			NSError *error = nil;
+			expect([(id<MTLTransformerErrorHandling>)transformer transformedValue:input success:&success error:&error]).to(beNil());
+			expect(@(success)).to(beFalsy());
+			expect(error.domain).to(equal(MTLTransformerErrorHandlingErrorDomain));
+			expect(@(error.code)).to(equal(@(MTLTransformerErrorHandlingErrorInvalidInput)));
+			expect(error.userInfo[MTLTransformerErrorHandlingInputValueErrorKey]).to(equal(dict));
+		});
+
+		it(@"should transform keyed models into JSON dictionaries ordered by key", ^{
+			expect(@([transformer.class allowsReverseTransformation])).to(beTruthy());
+
+			expect([transformer reverseTransformedValue:modelsByCount]).to(equal(JSONDictionaries));
+		});
+
+		itBehavesLike(MTLTransformerErrorExamples, ^{
+			return @{
+				MTLTransformerErrorExamplesTransformer: transformer,
+				MTLTransformerErrorExamplesInvalidTransformationInput: NSNull.null,
+				MTLTransformerErrorExamplesInvalidReverseTransformationInput: NSNull.null
+			};
+		});
+	});
+
+	describe(@"keyed dictionary transformer", ^{
+		__block NSValueTransformer *transformer;
+
+		__block NSDictionary *models;
+		__block NSDictionary *JSONDictionaries;
+
+		beforeEach(^{
+			MTLTestModel *first = [[MTLTestModel alloc] init];
+			first.name = @"first";
+
+			MTLTestModel *second = [[MTLTestModel alloc] init];
+			second.name = @"second";
+
+			models = @{
+				@"1": first,
+				@"2": second,
+				@"3": NSNull.null
+			};
+
+			JSONDictionaries = @{
+				@"1": [MTLJSONAdapter JSONDictionaryFromModel:first error:NULL],
+				@"2": [MTLJSONAdapter JSONDictionaryFromModel:second error:NULL],
+				@"3": NSNull.null
+			};
+
+			transformer = [MTLJSONAdapter keyedDictionaryTransformerWithModelClass:MTLTestModel.class];
+			expect(transformer).notTo(beNil());
+		});
+
+		it(@"should transform a JSON dictionary of JSON dictionaries into models", ^{
+			expect([transformer transformedValue:JSONDictionaries]).to(equal(models));
+		});
+
+		it(@"should transform models into a JSON dictionary of JSON dictionaries", ^{
+			expect(@([transformer.class allowsReverseTransformation])).to(beTruthy());
+			expect([transformer reverseTransformedValue:models]).to(equal(JSONDictionaries));
+		});
+
+		itBehavesLike(MTLTransformerErrorExamples, ^{
+			return @{
+				MTLTransformerErrorExamplesTransformer: transformer,
+				MTLTransformerErrorExamplesInvalidTransformationInput: @{ @"1": @"not a dictionary" },
+				MTLTransformerErrorExamplesInvalidReverseTransformationInput: NSNull.null
+			};
+		});
+	});
+
 	it(@"should use receiving class for serialization", ^{
 		NSDictionary *values = @{
 			@"username": @"foo",
@@ -521,6 +724,761 @@ describe(@"JSON transformers", ^{
 	});
 });
 
+describe(@"updating models in place", ^{
+	__block MTLJSONAdapter *adapter;
+	__block MTLTestModel *model;
+
+	beforeEach(^{
+		adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+
+		model = [MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:@{
+			@"username": @"foo",
+			@"count": @"5",
+			@"nested": @{ @"name": @"bar" }
+		} error:NULL];
+		expect(model).notTo(beNil());
+	});
+
+	it(@"should only update properties present in the JSON dictionary", ^{
+		NSError *error = nil;
+		BOOL success = [adapter updateModel:model withJSONDictionary:@{ @"count": @"7" } error:&error];
+		expect(@(success)).to(beTruthy());
+		expect(error).to(beNil());
+
+		expect(@(model.count)).to(equal(@7));
+		expect(model.name).to(equal(@"foo"));
+		expect(model.nestedName).to(equal(@"bar"));
+	});
+
+	it(@"should update properties at nested key paths", ^{
+		BOOL success = [adapter updateModel:model withJSONDictionary:@{ @"nested": @{ @"name": @"baz" } } error:NULL];
+		expect(@(success)).to(beTruthy());
+
+		expect(model.nestedName).to(equal(@"baz"));
+		expect(model.name).to(equal(@"foo"));
+	});
+
+	it(@"should set properties to nil for null values", ^{
+		BOOL success = [adapter updateModel:model withJSONDictionary:@{ @"username": NSNull.null } error:NULL];
+		expect(@(success)).to(beTruthy());
+
+		expect(model.name).to(beNil());
+		expect(@(model.count)).to(equal(@5));
+	});
+
+	it(@"should validate updated properties", ^{
+		NSError *error = nil;
+		BOOL success = [adapter updateModel:model withJSONDictionary:@{ @"username": @"this is too long a name" } error:&error];
+		expect(@(success)).to(beFalsy());
+
+		expect(error).notTo(beNil());
+		expect(error.domain).to(equal(MTLTestModelErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLTestModelNameTooLong)));
+		expect(model.name).to(equal(@"foo"));
+	});
+
+	it(@"should update nested models in place", ^{
+		MTLPropertyDefaultAdapterModel *parent = [MTLJSONAdapter modelOfClass:MTLPropertyDefaultAdapterModel.class fromJSONDictionary:@{
+			@"property": @"property",
+			@"conformingMTLJSONSerializingProperty": @{
+				@"username": @"foo",
+				@"count": @"5",
+			},
+			@"nonConformingMTLJSONSerializingProperty": NSNull.null
+		} error:NULL];
+		expect(parent).notTo(beNil());
+
+		MTLTestModel *nestedModel = parent.conformingMTLJSONSerializingProperty;
+
+		MTLJSONAdapter *parentAdapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLPropertyDefaultAdapterModel.class];
+		BOOL success = [parentAdapter updateModel:parent withJSONDictionary:@{
+			@"conformingMTLJSONSerializingProperty": @{ @"count": @"9" }
+		} error:NULL];
+		expect(@(success)).to(beTruthy());
+
+		expect(parent.conformingMTLJSONSerializingProperty).to(beIdenticalTo(nestedModel));
+		expect(@(nestedModel.count)).to(equal(@9));
+		expect(nestedModel.name).to(equal(@"foo"));
+		expect(parent.property).to(equal(@"property"));
+	});
+
+	it(@"should fail for a JSON value which isn't a dictionary", ^{
+		NSError *error = nil;
+		BOOL success = [adapter updateModel:model withJSONDictionary:(id)@[] error:&error];
+		expect(@(success)).to(beFalsy());
+
+		expect(error.domain).to(equal(MTLJSONAdapterErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorInvalidJSONDictionary)));
+	});
+});
+
+describe(@"JSON patches", ^{
+	__block MTLJSONAdapter *adapter;
+	__block MTLTestModel *oldModel;
+	__block MTLTestModel *newModel;
+
+	beforeEach(^{
+		adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+
+		oldModel = [MTLTestModel modelWithDictionary:@{
+			@"name": @"foo",
+			@"count": @5,
+			@"nestedName": @"bar"
+		} error:NULL];
+		expect(oldModel).notTo(beNil());
+
+		newModel = [oldModel copy];
+	});
+
+	it(@"should be empty for equal models", ^{
+		NSError *error = nil;
+		NSArray *patch = [adapter JSONPatchFromModel:oldModel toModel:newModel error:&error];
+		expect(patch).to(equal(@[]));
+		expect(error).to(beNil());
+	});
+
+	it(@"should replace changed values at their JSON key paths", ^{
+		newModel.count = 7;
+		newModel.nestedName = @"a/b";
+
+		NSArray *patch = [adapter JSONPatchFromModel:oldModel toModel:newModel error:NULL];
+		expect(patch).to(equal(@[
+			@{ @"op": @"replace", @"path": @"/count", @"value": @"7" },
+			@{ @"op": @"replace", @"path": @"/nested/name", @"value": @"a/b" },
+		]));
+	});
+
+	it(@"should replace values which became nil with null", ^{
+		newModel.name = nil;
+
+		NSArray *patch = [adapter JSONPatchFromModel:oldModel toModel:newModel error:NULL];
+		expect(patch).to(equal(@[
+			@{ @"op": @"replace", @"path": @"/username", @"value": NSNull.null },
+		]));
+	});
+
+	it(@"should patch nested models member by member", ^{
+		MTLPropertyDefaultAdapterModel *oldParent = [MTLPropertyDefaultAdapterModel modelWithDictionary:@{
+			@"property": @"property",
+			@"conformingMTLJSONSerializingProperty": oldModel
+		} error:NULL];
+
+		newModel.name = @"qux";
+
+		MTLPropertyDefaultAdapterModel *newParent = [oldParent copy];
+		newParent.conformingMTLJSONSerializingProperty = newModel;
+
+		MTLJSONAdapter *parentAdapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLPropertyDefaultAdapterModel.class];
+
+		NSArray *patch = [parentAdapter JSONPatchFromModel:oldParent toModel:newParent error:NULL];
+		expect(patch).to(equal(@[
+			@{ @"op": @"replace", @"path": @"/conformingMTLJSONSerializingProperty/username", @"value": @"qux" },
+		]));
+	});
+
+	it(@"should replace the whole document for models of different classes", ^{
+		MTLSubclassTestModel *subclassModel = [MTLSubclassTestModel modelWithDictionary:@{ @"name": @"foo" } error:NULL];
+
+		NSArray *patch = [adapter JSONPatchFromModel:oldModel toModel:subclassModel error:NULL];
+		expect(@(patch.count)).to(equal(@1));
+		expect(patch[0][@"op"]).to(equal(@"replace"));
+		expect(patch[0][@"path"]).to(equal(@""));
+		expect(patch[0][@"value"]).to(equal([MTLJSONAdapter JSONDictionaryFromModel:subclassModel error:NULL]));
+	});
+});
+
+describe(@"serializing immutable models", ^{
+	__block MTLImmutableTestModel *owner;
+
+	beforeEach(^{
+		owner = [MTLImmutableTestModel modelWithDictionary:@{ @"firstName": @"foo", @"count": @2 } error:NULL];
+		expect(owner).notTo(beNil());
+	});
+
+	it(@"should reuse the JSON dictionary of an immutable model", ^{
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:owner error:NULL];
+		expect(JSONDictionary[@"firstName"]).to(equal(@"foo"));
+
+		expect([MTLJSONAdapter JSONDictionaryFromModel:owner error:NULL]).to(beIdenticalTo(JSONDictionary));
+	});
+
+	it(@"should reuse the JSON dictionary of nested immutable models", ^{
+		NSDictionary *ownerJSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:owner error:NULL];
+
+		MTLInterningTestModel *model = [MTLInterningTestModel modelWithDictionary:@{ @"owner": owner } error:NULL];
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+
+		expect(JSONDictionary[@"owner"]).to(beIdenticalTo(ownerJSONDictionary));
+	});
+
+	it(@"should not reuse the JSON dictionary of a mutable model", ^{
+		MTLTestModel *model = [MTLTestModel modelWithDictionary:@{ @"name": @"foo" } error:NULL];
+
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+		expect([MTLJSONAdapter JSONDictionaryFromModel:model error:NULL]).notTo(beIdenticalTo(JSONDictionary));
+	});
+
+	it(@"should reuse the JSON dictionary of an immutable model holding immutable values", ^{
+		MTLImmutableWrapperTestModel *model = [MTLImmutableWrapperTestModel modelWithDictionary:@{ @"value": @[ owner ] } error:NULL];
+
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+		expect([MTLJSONAdapter JSONDictionaryFromModel:model error:NULL]).to(beIdenticalTo(JSONDictionary));
+	});
+
+	it(@"should not reuse the JSON dictionary of an immutable model holding a mutable collection", ^{
+		NSMutableArray *values = [NSMutableArray arrayWithObject:@"foo"];
+		MTLImmutableWrapperTestModel *model = [MTLImmutableWrapperTestModel modelWithDictionary:@{ @"value": values } error:NULL];
+
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+		expect(JSONDictionary[@"value"]).to(equal(@[ @"foo" ]));
+
+		[values addObject:@"bar"];
+
+		NSDictionary *newJSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+		expect(newJSONDictionary).notTo(beIdenticalTo(JSONDictionary));
+		expect(newJSONDictionary[@"value"]).to(equal(@[ @"foo", @"bar" ]));
+	});
+
+	it(@"should discard memoized JSON when a value is set through key-value coding", ^{
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:owner error:NULL];
+
+		[owner setValue:@"bar" forKey:@"firstName"];
+
+		NSDictionary *newJSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:owner error:NULL];
+		expect(newJSONDictionary).notTo(beIdenticalTo(JSONDictionary));
+		expect(newJSONDictionary[@"firstName"]).to(equal(@"bar"));
+	});
+});
+
+describe(@"omission policies", ^{
+	it(@"should leave out nil and default values", ^{
+		MTLOmissionTestModel *model = [[MTLOmissionTestModel alloc] init];
+		model.mode = @"default";
+		model.status = @"unknown";
+
+		NSError *error = nil;
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:model error:&error];
+		expect(JSONDictionary).to(equal(@{ @"note": NSNull.null }));
+		expect(error).to(beNil());
+	});
+
+	it(@"should serialize other values", ^{
+		MTLOmissionTestModel *model = [[MTLOmissionTestModel alloc] init];
+		model.URL = [NSURL URLWithString:@"http://example.com"];
+		model.count = 2;
+		model.mode = @"fast";
+		model.note = @"foo";
+		model.status = @"active";
+
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+		expect(JSONDictionary).to(equal(@{
+			@"URL": @"http://example.com",
+			@"count": @2,
+			@"mode": @"fast",
+			@"note": @"foo",
+			@"status": @"active"
+		}));
+	});
+
+	it(@"should not invoke the transformer of values which are left out before transforming them", ^{
+		MTLOmissionTestModel *model = [[MTLOmissionTestModel alloc] init];
+		NSUInteger count = MTLOmissionTestModel.URLReverseTransformationCount;
+
+		[MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+		expect(@(MTLOmissionTestModel.URLReverseTransformationCount)).to(equal(@(count)));
+
+		model.URL = [NSURL URLWithString:@"http://example.com"];
+
+		[MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+		expect(@(MTLOmissionTestModel.URLReverseTransformationCount)).to(equal(@(count + 1)));
+	});
+});
+
+describe(@"canonical JSON", ^{
+	NSString * (^canonicalJSONString)(id<MTLJSONSerializing>) = ^(id<MTLJSONSerializing> model) {
+		NSError *error = nil;
+		NSData *data = [MTLJSONAdapter canonicalJSONDataFromModel:model error:&error];
+		expect(error).to(beNil());
+
+		return [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+	};
+
+	it(@"should sort keys and leave out whitespace", ^{
+		MTLTestModel *model = [MTLTestModel modelWithDictionary:@{
+			@"name": @"foo",
+			@"count": @5,
+			@"nestedName": @"bar"
+		} error:NULL];
+
+		expect(canonicalJSONString(model)).to(equal(@"{\"count\":\"5\",\"nested\":{\"name\":\"bar\"},\"username\":\"foo\"}"));
+	});
+
+	it(@"should normalize numbers and escape strings", ^{
+		MTLImmutableTestModel *model = [MTLImmutableTestModel modelWithDictionary:@{
+			@"firstName": @"a\"b\\c\n\u00e9",
+			@"count": @2,
+			@"ratio": @1e21
+		} error:NULL];
+
+		expect(canonicalJSONString(model)).to(equal(@"{\"count\":2,\"firstName\":\"a\\\"b\\\\c\\n\u00e9\",\"lastName\":null,\"ratio\":1e+21}"));
+	});
+
+	it(@"should write large integers in their shortest form as doubles", ^{
+		MTLImmutableTestModel *model = [MTLImmutableTestModel modelWithDictionary:@{ @"count": @(1LL << 60) } error:NULL];
+		expect(canonicalJSONString(model)).to(equal(@"{\"count\":1152921504606847000,\"firstName\":null,\"lastName\":null,\"ratio\":0}"));
+	});
+
+	it(@"should fail on integers which doubles can't represent exactly", ^{
+		MTLImmutableTestModel *model = [MTLImmutableTestModel modelWithDictionary:@{ @"count": @((1LL << 53) + 1) } error:NULL];
+
+		NSError *error = nil;
+		expect([MTLJSONAdapter canonicalJSONDataFromModel:model error:&error]).to(beNil());
+		expect(error.domain).to(equal(MTLJSONAdapterErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorInvalidJSONValue)));
+	});
+
+	it(@"should produce the same bytes for equal models", ^{
+		MTLImmutableTestModel *model = [MTLImmutableTestModel modelWithDictionary:@{ @"firstName": @"foo", @"ratio": @0.1 } error:NULL];
+		MTLImmutableTestModel *otherModel = [MTLImmutableTestModel modelWithDictionary:@{ @"ratio": @0.1, @"firstName": @"foo" } error:NULL];
+
+		NSData *data = [MTLJSONAdapter canonicalJSONDataFromModel:model error:NULL];
+		expect(data).to(equal([MTLJSONAdapter canonicalJSONDataFromModel:otherModel error:NULL]));
+		expect(canonicalJSONString(model)).to(equal(@"{\"count\":0,\"firstName\":\"foo\",\"lastName\":null,\"ratio\":0.1}"));
+	});
+});
+
+describe(@"decoding arrays concurrently", ^{
+	__block MTLJSONAdapter *adapter;
+	__block NSMutableArray *users;
+
+	beforeEach(^{
+		adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveGroupModel.class];
+		adapter.parallelArrayThreshold = 10;
+
+		users = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 100; i++) {
+			[users addObject:@{ @"name": [NSString stringWithFormat:@"user %lu", (unsigned long)i], @"groups": @[] }];
+		}
+	});
+
+	it(@"should decode the same model as decoding serially", ^{
+		NSDictionary *JSONDictionary = @{ @"owner": @{ @"name": @"owner" }, @"users": users };
+
+		NSError *error = nil;
+		MTLRecursiveGroupModel *group = [adapter modelFromJSONDictionary:JSONDictionary error:&error];
+		expect(group).notTo(beNil());
+		expect(error).to(beNil());
+
+		MTLJSONAdapter *serialAdapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveGroupModel.class];
+		expect(group).to(equal([serialAdapter modelFromJSONDictionary:JSONDictionary error:NULL]));
+		expect(@(group.users.count)).to(equal(@100));
+		expect([group.users[42] name]).to(equal(@"user 42"));
+	});
+
+	it(@"should report the error of a concurrently decoded array", ^{
+		[users replaceObjectAtIndex:50 withObject:@"bad user"];
+
+		NSError *error = nil;
+		expect([adapter modelFromJSONDictionary:@{ @"users": users } error:&error]).to(beNil());
+		expect(error.domain).to(equal(MTLTransformerErrorHandlingErrorDomain));
+		expect(error.userInfo[MTLTransformerErrorHandlingInputValueErrorKey]).to(equal(@"bad user"));
+	});
+
+	it(@"should report the error of the first failing property", ^{
+		[users replaceObjectAtIndex:50 withObject:@"bad user"];
+
+		NSError *error = nil;
+		expect([adapter modelFromJSONDictionary:@{ @"owner": @"bad owner", @"users": users } error:&error]).to(beNil());
+		expect(error.userInfo[MTLTransformerErrorHandlingInputValueErrorKey]).to(equal(@"bad owner"));
+	});
+
+	it(@"should report the error of a concurrently decoded array before later properties", ^{
+		NSMutableArray *groups = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 20; i++) {
+			[groups addObject:@{ @"users": @[] }];
+		}
+
+		// Strings would exceed the limit below before being transformed.
+		[groups replaceObjectAtIndex:10 withObject:@42];
+
+		// The name is read after the groups, and fails on the current thread.
+		MTLJSONDecodingLimits *limits = [[MTLJSONDecodingLimits alloc] init];
+		limits.maximumStringLength = 4;
+
+		MTLJSONAdapter *userAdapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveUserModel.class];
+		userAdapter.parallelArrayThreshold = 10;
+		userAdapter.limits = limits;
+
+		NSError *error = nil;
+		expect([userAdapter modelFromJSONDictionary:@{ @"groups": groups, @"name": @"too long" } error:&error]).to(beNil());
+		expect(error.userInfo[MTLTransformerErrorHandlingInputValueErrorKey]).to(equal(@42));
+
+		// Each failure is reported on its own, too.
+		[groups replaceObjectAtIndex:10 withObject:@{ @"users": @[] }];
+		expect([userAdapter modelFromJSONDictionary:@{ @"groups": groups, @"name": @"too long" } error:&error]).to(beNil());
+		expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorLimitExceeded)));
+	});
+
+	it(@"should decode a single array on the calling thread", ^{
+		NSMutableArray *children = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 20; i++) {
+			[children addObject:@{ @"name": [NSString stringWithFormat:@"child %lu", (unsigned long)i] }];
+		}
+
+		MTLJSONAdapter *raisingAdapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRaisingTestModel.class];
+		raisingAdapter.parallelArrayThreshold = 10;
+
+		[MTLRaisingTestModel resetParsingThreads];
+
+		MTLRaisingTestModel *model = [raisingAdapter modelFromJSONDictionary:@{ @"children": children } error:NULL];
+		expect(@(model.children.count)).to(equal(@20));
+		expect(MTLRaisingTestModel.parsingThreads).to(equal([NSSet setWithObject:NSThread.currentThread]));
+	});
+
+	it(@"should handle exceptions of concurrently decoded arrays on the calling thread", ^{
+		NSMutableArray *children = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 20; i++) {
+			[children addObject:@{ @"name": [NSString stringWithFormat:@"child %lu", (unsigned long)i] }];
+		}
+
+		[children replaceObjectAtIndex:15 withObject:@{ @"raise": @YES }];
+
+		// Returns the code of the error, or the name of the exception if one is
+		// rethrown because a debugger is attached.
+		id (^decode)(NSUInteger) = ^ id (NSUInteger parallelArrayThreshold) {
+			MTLJSONAdapter *raisingAdapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRaisingTestModel.class];
+			raisingAdapter.parallelArrayThreshold = parallelArrayThreshold;
+
+			@try {
+				NSError *error = nil;
+				expect([raisingAdapter modelFromJSONDictionary:@{ @"children": children } error:&error]).to(beNil());
+				expect(error.domain).to(equal(MTLJSONAdapterErrorDomain));
+
+				return @(error.code);
+			} @catch (NSException *ex) {
+				return ex.name;
+			}
+		};
+
+		id result = decode(10);
+		expect(result).to(equal(decode(0)));
+		expect(@[ @(MTLJSONAdapterErrorExceptionThrown), NSInternalInconsistencyException ]).to(contain(result));
+	});
+});
+
+describe(@"decoding iteratively", ^{
+	__block MTLJSONAdapter *adapter;
+
+	beforeEach(^{
+		adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveUserModel.class];
+		adapter.decodesIteratively = YES;
+	});
+
+	it(@"should decode the same model as decoding recursively", ^{
+		NSDictionary *JSONDictionary = @{
+			@"name": @"root",
+			@"groups": @[
+				@{ @"owner": @{ @"name": @"owner" }, @"users": @[ MTLNestedUserJSONDictionary(3, @{ @"name": @"leaf" }), NSNull.null ] },
+				@{ @"owner": NSNull.null },
+			],
+		};
+
+		NSError *error = nil;
+		MTLRecursiveUserModel *user = [adapter modelFromJSONDictionary:JSONDictionary error:&error];
+		expect(user).notTo(beNil());
+		expect(error).to(beNil());
+
+		MTLJSONAdapter *recursiveAdapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveUserModel.class];
+		expect(user).to(equal([recursiveAdapter modelFromJSONDictionary:JSONDictionary error:NULL]));
+	});
+
+	it(@"should decode deeply nested models on a thread with a small stack", ^{
+		NSUInteger depth = 1000;
+		NSDictionary *JSONDictionary = MTLNestedUserJSONDictionary(depth, @{ @"name": @"leaf" });
+
+		__block MTLRecursiveUserModel *user;
+		__block NSError *error;
+
+		pthread_attr_t attributes;
+		pthread_attr_init(&attributes);
+		pthread_attr_setstacksize(&attributes, 128 * 1024);
+
+		pthread_t thread;
+		pthread_create(&thread, &attributes, MTLRunBlock, (__bridge_retained void *)[^{
+			@autoreleasepool {
+				user = [adapter modelFromJSONDictionary:JSONDictionary error:&error];
+			}
+		} copy]);
+
+		pthread_join(thread, NULL);
+		pthread_attr_destroy(&attributes);
+
+		expect(user).notTo(beNil());
+		expect(error).to(beNil());
+
+		NSUInteger levels = 0;
+		while (user.groups.count > 0) {
+			MTLRecursiveGroupModel *group = user.groups[0];
+			user = group.users[0];
+			levels++;
+		}
+
+		expect(@(levels)).to(equal(@(depth)));
+		expect(user.name).to(equal(@"leaf"));
+	});
+
+	it(@"should report errors of deeply nested models", ^{
+		NSError *error = nil;
+		expect([adapter modelFromJSONDictionary:MTLNestedUserJSONDictionary(100, @"bad user") error:&error]).to(beNil());
+		expect(error.domain).to(equal(MTLTransformerErrorHandlingErrorDomain));
+		expect(error.userInfo[MTLTransformerErrorHandlingInputValueErrorKey]).to(equal(@"bad user"));
+	});
+
+	it(@"should decode nested models with adapters of the class of their transformers", ^{
+		MTLJSONAdapter *nestedAdapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLNestedAdapterTestModel.class];
+
+		NSDictionary *JSONDictionary = @{
+			@"name": @"root",
+			@"child": @{ @"name": @"child", @"children": @[ @{ @"name": @"grandchild" } ] },
+			@"children": @[ @{ @"name": @"first" }, @{ @"name": @"second" } ],
+		};
+
+		nestedAdapter.decodesIteratively = NO;
+		MTLNestedAdapterTestModel *recursiveModel = [nestedAdapter modelFromJSONDictionary:JSONDictionary error:NULL];
+
+		nestedAdapter.decodesIteratively = YES;
+		MTLNestedAdapterTestModel *model = [nestedAdapter modelFromJSONDictionary:JSONDictionary error:NULL];
+
+		expect(model.name).to(equal(@"root"));
+		expect(model.child.name).to(equal(@"CHILD"));
+		expect([model.child.children[0] name]).to(equal(@"GRANDCHILD"));
+		expect([model.children[1] name]).to(equal(@"SECOND"));
+		expect(model).to(equal(recursiveModel));
+	});
+
+	it(@"should handle exceptions of nested models like decoding recursively", ^{
+		MTLJSONAdapter *raisingAdapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRaisingTestModel.class];
+
+		// Returns the code of the error, or the name of the exception if one is
+		// rethrown because a debugger is attached.
+		id (^decode)(NSDictionary *, BOOL) = ^ id (NSDictionary *JSONDictionary, BOOL decodesIteratively) {
+			raisingAdapter.decodesIteratively = decodesIteratively;
+
+			@try {
+				NSError *error = nil;
+				expect([raisingAdapter modelFromJSONDictionary:JSONDictionary error:&error]).to(beNil());
+				expect(error.domain).to(equal(MTLJSONAdapterErrorDomain));
+
+				return @(error.code);
+			} @catch (NSException *ex) {
+				return ex.name;
+			}
+		};
+
+		NSArray *JSONDictionaries = @[
+			@{ @"child": @{ @"raise": @YES } },
+			@{ @"children": @[ @{ @"name": @"a" }, @{ @"raise": @YES } ] },
+			@{ @"child": @{ @"child": @{ @"name": @"raise" } } },
+		];
+
+		for (NSDictionary *JSONDictionary in JSONDictionaries) {
+			id result = decode(JSONDictionary, YES);
+			expect(result).to(equal(decode(JSONDictionary, NO)));
+			expect(@[ @(MTLJSONAdapterErrorExceptionThrown), NSInternalInconsistencyException ]).to(contain(result));
+		}
+	});
+});
+
+describe(@"preserving references", ^{
+	__block MTLRecursiveUserModel *owner;
+	__block MTLRecursiveUserModel *member;
+	__block MTLRecursiveGroupModel *group;
+
+	NSDictionary *JSONDictionary = @{
+		@"$id": @"1",
+		@"owner": @{
+			@"$id": @"2",
+			@"name": @"Cameron",
+			@"groups": @[ @{ @"$ref": @"1" } ],
+		},
+		@"users": @[
+			@{ @"$ref": @"2" },
+			@{ @"$id": @"3", @"name": @"Dimitri" },
+		],
+	};
+
+	beforeEach(^{
+		owner = [MTLRecursiveUserModel modelWithDictionary:@{ @"name": @"Cameron" } error:NULL];
+		member = [MTLRecursiveUserModel modelWithDictionary:@{ @"name": @"Dimitri" } error:NULL];
+		group = [MTLRecursiveGroupModel modelWithDictionary:@{ @"owner": owner, @"users": @[ owner, member ] } error:NULL];
+
+		[owner setValue:@[ group ] forKey:@"groups"];
+	});
+
+	afterEach(^{
+		// Break the cycle.
+		[owner setValue:nil forKey:@"groups"];
+	});
+
+	it(@"should serialize shared and recursive models only once", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveGroupModel.class];
+		adapter.preservesReferences = YES;
+
+		NSError *error = nil;
+		NSDictionary *result = [adapter JSONDictionaryFromModel:group error:&error];
+		expect(error).to(beNil());
+		expect(result).to(equal(JSONDictionary));
+	});
+
+	it(@"should restart reference IDs for every serialization", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveUserModel.class];
+		adapter.preservesReferences = YES;
+
+		NSDictionary *first = [adapter JSONDictionaryFromModel:member error:NULL];
+		NSDictionary *second = [adapter JSONDictionaryFromModel:member error:NULL];
+
+		expect(first).to(equal((@{ @"$id": @"1", @"name": @"Dimitri" })));
+		expect(second).to(equal(first));
+	});
+
+	it(@"should restore shared and recursive models", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveGroupModel.class];
+		adapter.preservesReferences = YES;
+
+		NSError *error = nil;
+		MTLRecursiveGroupModel *decodedGroup = [adapter modelFromJSONDictionary:JSONDictionary error:&error];
+		expect(error).to(beNil());
+		expect(decodedGroup).notTo(beNil());
+
+		MTLRecursiveUserModel *decodedOwner = decodedGroup.owner;
+		expect(decodedOwner.name).to(equal(@"Cameron"));
+		expect(decodedGroup.users[0]).to(beIdenticalTo(decodedOwner));
+		expect(decodedOwner.groups[0]).to(beIdenticalTo(decodedGroup));
+		expect([decodedGroup.users[1] name]).to(equal(@"Dimitri"));
+
+		[decodedOwner setValue:nil forKey:@"groups"];
+	});
+
+	it(@"should fail on references to unknown models", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveGroupModel.class];
+		adapter.preservesReferences = YES;
+
+		NSError *error = nil;
+		MTLRecursiveGroupModel *decodedGroup = [adapter modelFromJSONDictionary:@{ @"owner": @{ @"$ref": @"7" } } error:&error];
+		expect(decodedGroup).to(beNil());
+		expect(error.domain).to(equal(MTLJSONAdapterErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorUnresolvedReference)));
+	});
+
+	it(@"should fail on references to models of the wrong class", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveGroupModel.class];
+		adapter.preservesReferences = YES;
+
+		NSError *error = nil;
+		MTLRecursiveGroupModel *decodedGroup = [adapter modelFromJSONDictionary:@{ @"$id": @"1", @"owner": @{ @"$ref": @"1" } } error:&error];
+		expect(decodedGroup).to(beNil());
+		expect(error.domain).to(equal(MTLJSONAdapterErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorUnresolvedReference)));
+	});
+
+	it(@"should expand shared models by default", ^{
+		NSError *error = nil;
+		NSDictionary *result = [MTLJSONAdapter JSONDictionaryFromModel:[MTLRecursiveGroupModel modelWithDictionary:@{ @"users": @[ member, member ] } error:NULL] error:&error];
+		expect(error).to(beNil());
+		expect(result).to(equal((@{ @"users": @[ @{ @"name": @"Dimitri" }, @{ @"name": @"Dimitri" } ] })));
+	});
+});
+
+describe(@"field masks", ^{
+	NSDictionary *groupJSONDictionary = @{
+		@"owner": @{
+			@"name": @"Cameron",
+			@"groups": @[ @{ @"users": @[] } ],
+		},
+		@"users": @[
+			@{ @"name": @"Dimitri" },
+		],
+	};
+
+	it(@"should only decode the properties in the mask", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+
+		NSError *error = nil;
+		MTLTestModel *model = [adapter modelFromJSONDictionary:@{ @"username": @"foo", @"count": @"5", @"nested": @{ @"name": @"bar" } } fieldMask:[NSSet setWithObject:@"name"] error:&error];
+		expect(error).to(beNil());
+		expect(model.name).to(equal(@"foo"));
+		expect(@(model.count)).to(equal(@1));
+		expect(model.nestedName).to(beNil());
+	});
+
+	it(@"should apply key paths to nested models", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveGroupModel.class];
+
+		NSError *error = nil;
+		MTLRecursiveGroupModel *group = [adapter modelFromJSONDictionary:groupJSONDictionary fieldMask:[NSSet setWithObject:@"owner.name"] error:&error];
+		expect(error).to(beNil());
+		expect(group.users).to(beNil());
+		expect(group.owner.name).to(equal(@"Cameron"));
+		expect(group.owner.groups).to(beNil());
+	});
+
+	it(@"should decode properties in full if they are included as a whole", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveGroupModel.class];
+
+		NSSet *fieldMask = [NSSet setWithObjects:@"owner", @"owner.name", nil];
+		MTLRecursiveGroupModel *group = [adapter modelFromJSONDictionary:groupJSONDictionary fieldMask:fieldMask error:NULL];
+		expect(@(group.owner.groups.count)).to(equal(@1));
+		expect([group.owner.groups[0] users]).to(equal(@[]));
+	});
+
+	it(@"should not validate partial models as a whole", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLValidationModel.class];
+
+		NSError *error = nil;
+		MTLValidationModel *model = [adapter modelFromJSONDictionary:@{} fieldMask:[NSSet set] error:&error];
+		expect(model).notTo(beNil());
+		expect(error).to(beNil());
+
+		model = [adapter modelFromJSONDictionary:@{ @"name": NSNull.null } fieldMask:[NSSet setWithObject:@"name"] error:&error];
+		expect(model).to(beNil());
+		expect(@(error.code)).to(equal(@(MTLTestModelNameMissing)));
+	});
+
+	it(@"should only serialize the properties in the mask", ^{
+		MTLTestModel *model = [MTLTestModel modelWithDictionary:@{ @"name": @"foo", @"count": @5, @"nestedName": @"bar" } error:NULL];
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+
+		NSError *error = nil;
+		NSDictionary *JSONDictionary = [adapter JSONDictionaryFromModel:model fieldMask:[NSSet setWithObjects:@"count", @"nestedName", nil] error:&error];
+		expect(error).to(beNil());
+		expect(JSONDictionary).to(equal((@{ @"count": @"5", @"nested": @{ @"name": @"bar" } })));
+	});
+
+	it(@"should not transform properties outside of the mask", ^{
+		MTLOmissionTestModel *model = [[MTLOmissionTestModel alloc] init];
+		model.URL = [NSURL URLWithString:@"http://example.com"];
+		model.count = 3;
+
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLOmissionTestModel.class];
+		NSUInteger transformationCount = MTLOmissionTestModel.URLReverseTransformationCount;
+
+		NSDictionary *JSONDictionary = [adapter JSONDictionaryFromModel:model fieldMask:[NSSet setWithObject:@"count"] error:NULL];
+		expect(JSONDictionary).to(equal(@{ @"count": @3 }));
+		expect(@(MTLOmissionTestModel.URLReverseTransformationCount)).to(equal(@(transformationCount)));
+	});
+
+	it(@"should apply key paths to nested models when serializing", ^{
+		MTLRecursiveUserModel *owner = [MTLRecursiveUserModel modelWithDictionary:@{ @"name": @"Cameron", @"groups": @[] } error:NULL];
+		MTLRecursiveGroupModel *group = [MTLRecursiveGroupModel modelWithDictionary:@{ @"owner": owner, @"users": @[ owner ] } error:NULL];
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveGroupModel.class];
+
+		NSError *error = nil;
+		NSDictionary *JSONDictionary = [adapter JSONDictionaryFromModel:group fieldMask:[NSSet setWithObject:@"owner.name"] error:&error];
+		expect(error).to(beNil());
+		expect(JSONDictionary).to(equal(@{ @"owner": @{ @"name": @"Cameron" } }));
+	});
+});
+
 describe(@"Deserializing multiple models", ^{
 	NSDictionary *value1 = @{
 		@"username": @"foo"
@@ -550,6 +1508,38 @@ describe(@"Deserializing multiple models", ^{
 
 		expect(models).to(equal(expected));
 	});
+
+	it(@"should only initialize models from JSON dictionaries matching a predicate", ^{
+		NSError *error = nil;
+		NSArray *mantleModels = [MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:JSONModels matchingPredicate:[NSPredicate predicateWithFormat:@"username == 'bar'"] error:&error];
+
+		expect(error).to(beNil());
+		expect(@(mantleModels.count)).to(equal(@1));
+		expect([mantleModels[0] name]).to(equal(@"bar"));
+	});
+
+	it(@"should resolve predicate key paths as JSON key paths", ^{
+		NSArray *JSONArray = @[
+			@{ @"username": @"foo", @"nested": @"not an object" },
+			@{ @"username": @"bar", @"nested": NSNull.null },
+			@{ @"username": @"baz", @"nested": @{ @"name": @"qux" } },
+		];
+
+		NSError *error = nil;
+		NSArray *mantleModels = [MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:JSONArray matchingPredicate:[NSPredicate predicateWithFormat:@"nested.name == 'qux' OR nested == nil"] error:&error];
+
+		expect(error).to(beNil());
+		expect([mantleModels valueForKey:@"name"]).to(equal(@[ @"bar", @"baz" ]));
+	});
+
+	it(@"should fail on elements which are not dictionaries", ^{
+		NSError *error = nil;
+		NSArray *mantleModels = [MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:@[ @{ @"username": @"foo" }, @"bar" ] matchingPredicate:[NSPredicate predicateWithFormat:@"username == 'foo'"] error:&error];
+
+		expect(mantleModels).to(beNil());
+		expect(error.domain).to(equal(MTLJSONAdapterErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorInvalidJSONDictionary)));
+	});
 });
 
 it(@"should return nil and an error if it fails to initialize any model from an array", ^{
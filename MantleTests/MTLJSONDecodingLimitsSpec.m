@@ -0,0 +1,194 @@
+//
+//  MTLJSONDecodingLimitsSpec.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLJSONDecodingLimitsSpec)
+
+// Returns the JSON of a user which is a member of a group with another user,
+// and so on, `depth` times. The result decodes into `2 * depth + 1` models.
+NSDictionary * (^nestedUserJSONDictionary)(NSUInteger) = ^ NSDictionary * (NSUInteger depth) {
+	id user = @{ @"name": @"leaf" };
+
+	for (NSUInteger i = 0; i < depth; i++) {
+		user = @{ @"name": @"user", @"groups": @[ @{ @"users": @[ user ] } ] };
+	}
+
+	return user;
+};
+
+__block MTLJSONDecodingLimits *limits;
+__block MTLJSONAdapter *adapter;
+
+beforeEach(^{
+	limits = [[MTLJSONDecodingLimits alloc] init];
+
+	adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveUserModel.class];
+	adapter.limits = limits;
+});
+
+void (^expectLimitExceeded)(NSDictionary *, NSString *) = ^(NSDictionary *JSONDictionary, NSString *limitKey) {
+	NSError *error = nil;
+	expect([adapter modelFromJSONDictionary:JSONDictionary error:&error]).to(beNil());
+	expect(error.domain).to(equal(MTLJSONAdapterErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorLimitExceeded)));
+	expect(error.userInfo[MTLJSONAdapterExceededLimitErrorKey]).to(equal(limitKey));
+};
+
+it(@"should not limit anything by default", ^{
+	MTLJSONDecodingLimits *defaultLimits = [[MTLJSONDecodingLimits alloc] init];
+	expect(@(defaultLimits.maximumDepth)).to(equal(@(NSUIntegerMax)));
+	expect(@(defaultLimits.maximumElementCount)).to(equal(@(NSUIntegerMax)));
+	expect(@(defaultLimits.maximumArrayLength)).to(equal(@(NSUIntegerMax)));
+	expect(@(defaultLimits.maximumStringLength)).to(equal(@(NSUIntegerMax)));
+	expect(@(defaultLimits.maximumModelCount)).to(equal(@(NSUIntegerMax)));
+
+	NSError *error = nil;
+	expect([adapter modelFromJSONDictionary:nestedUserJSONDictionary(50) error:&error]).notTo(beNil());
+	expect(error).to(beNil());
+});
+
+it(@"should copy limits", ^{
+	limits.maximumDepth = 5;
+
+	MTLJSONDecodingLimits *copiedLimits = [limits copy];
+	limits.maximumDepth = 6;
+
+	expect(@(copiedLimits.maximumDepth)).to(equal(@5));
+});
+
+it(@"should limit the depth of nested models", ^{
+	limits.maximumDepth = 21;
+	adapter.limits = limits;
+	expect([adapter modelFromJSONDictionary:nestedUserJSONDictionary(10) error:NULL]).notTo(beNil());
+
+	limits.maximumDepth = 20;
+	adapter.limits = limits;
+	expectLimitExceeded(nestedUserJSONDictionary(10), @"maximumDepth");
+});
+
+it(@"should limit the depth of nested models when decoding iteratively", ^{
+	limits.maximumDepth = 20;
+	adapter.limits = limits;
+	adapter.decodesIteratively = YES;
+
+	expectLimitExceeded(nestedUserJSONDictionary(10), @"maximumDepth");
+});
+
+it(@"should limit the depth of JSON within nested models when decoding iteratively", ^{
+	// The array of users is the only value at the third level.
+	NSDictionary *JSONDictionary = @{ @"name": @"root", @"groups": @[ @{ @"users": @[] } ] };
+
+	for (NSNumber *decodesIteratively in @[ @NO, @YES ]) {
+		adapter.decodesIteratively = decodesIteratively.boolValue;
+
+		limits.maximumDepth = 3;
+		adapter.limits = limits;
+		expect([adapter modelFromJSONDictionary:JSONDictionary error:NULL]).notTo(beNil());
+
+		limits.maximumDepth = 2;
+		adapter.limits = limits;
+		expectLimitExceeded(JSONDictionary, @"maximumDepth");
+	}
+});
+
+it(@"should limit the depth of models updated in place", ^{
+	MTLJSONAdapter *groupAdapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveGroupModel.class];
+	MTLRecursiveGroupModel *group = [groupAdapter modelFromJSONDictionary:@{ @"owner": @{ @"name": @"owner" } } error:NULL];
+	expect(group.owner).notTo(beNil());
+
+	// The owner is updated at the second level, and the users of its group are
+	// at the fourth.
+	NSDictionary *JSONDictionary = @{ @"owner": @{ @"groups": @[ @{ @"users": @[] } ] } };
+
+	limits.maximumDepth = 4;
+	groupAdapter.limits = limits;
+	expect(@([groupAdapter updateModel:group withJSONDictionary:JSONDictionary error:NULL])).to(beTruthy());
+
+	limits.maximumDepth = 3;
+	groupAdapter.limits = limits;
+
+	NSError *error = nil;
+	expect(@([groupAdapter updateModel:group withJSONDictionary:JSONDictionary error:&error])).to(beFalsy());
+	expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorLimitExceeded)));
+	expect(error.userInfo[MTLJSONAdapterExceededLimitErrorKey]).to(equal(@"maximumDepth"));
+});
+
+it(@"should limit the number of models", ^{
+	limits.maximumModelCount = 21;
+	adapter.limits = limits;
+	expect([adapter modelFromJSONDictionary:nestedUserJSONDictionary(10) error:NULL]).notTo(beNil());
+
+	limits.maximumModelCount = 20;
+	adapter.limits = limits;
+	expectLimitExceeded(nestedUserJSONDictionary(10), @"maximumModelCount");
+});
+
+it(@"should limit the length of arrays", ^{
+	limits.maximumArrayLength = 2;
+	adapter.limits = limits;
+
+	NSDictionary *group = @{ @"users": @[ @{ @"name": @"a" }, @{ @"name": @"b" }, @{ @"name": @"c" } ] };
+	expectLimitExceeded(@{ @"name": @"root", @"groups": @[ group ] }, @"maximumArrayLength");
+});
+
+it(@"should limit the total number of array elements", ^{
+	limits.maximumElementCount = 4;
+	adapter.limits = limits;
+
+	NSDictionary *group = @{ @"users": @[ @{ @"name": @"a" }, @{ @"name": @"b" } ] };
+	expect([adapter modelFromJSONDictionary:@{ @"groups": @[ group ] } error:NULL]).notTo(beNil());
+
+	expectLimitExceeded(@{ @"groups": @[ group, group ] }, @"maximumElementCount");
+});
+
+it(@"should limit the length of strings in bytes of UTF-8", ^{
+	limits.maximumStringLength = 6;
+	adapter.limits = limits;
+
+	expect([adapter modelFromJSONDictionary:@{ @"name": @"ééé" } error:NULL]).notTo(beNil());
+	expectLimitExceeded(@{ @"name": @"éééa" }, @"maximumStringLength");
+	expectLimitExceeded(@{ @"name": @"abcdefg" }, @"maximumStringLength");
+});
+
+it(@"should limit models decoded into columns", ^{
+	limits.maximumArrayLength = 1;
+	adapter.limits = limits;
+
+	NSError *error = nil;
+	expect([adapter columnarModelArrayFromJSONArray:@[ @{}, @{} ] fieldMask:nil error:&error]).to(beNil());
+	expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorLimitExceeded)));
+});
+
+it(@"should count rows decoded into columns as models", ^{
+	limits.maximumModelCount = 1;
+	adapter.limits = limits;
+
+	NSError *error = nil;
+	expect([adapter columnarModelArrayFromJSONArray:@[ @{}, @{} ] fieldMask:nil error:&error]).to(beNil());
+	expect(error.userInfo[MTLJSONAdapterExceededLimitErrorKey]).to(equal(@"maximumModelCount"));
+});
+
+it(@"should limit the depth of JSON within rows decoded into columns", ^{
+	limits.maximumDepth = 2;
+	adapter.limits = limits;
+	expect([adapter columnarModelArrayFromJSONArray:@[ @{ @"groups": @[] } ] fieldMask:nil error:NULL]).notTo(beNil());
+
+	limits.maximumDepth = 1;
+	adapter.limits = limits;
+
+	NSError *error = nil;
+	expect([adapter columnarModelArrayFromJSONArray:@[ @{ @"groups": @[] } ] fieldMask:nil error:&error]).to(beNil());
+	expect(error.userInfo[MTLJSONAdapterExceededLimitErrorKey]).to(equal(@"maximumDepth"));
+});
+
+QuickSpecEnd
@@ -0,0 +1,131 @@
+//
+//  MTLMemoizingValueTransformerSpec.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTransformerErrorExamples.h"
+
+QuickSpecBegin(MTLMemoizingValueTransformerSpec)
+
+__block NSUInteger forwardInvocations;
+__block NSUInteger reverseInvocations;
+__block MTLValueTransformer *countingTransformer;
+
+beforeEach(^{
+	forwardInvocations = 0;
+	reverseInvocations = 0;
+
+	countingTransformer = [MTLValueTransformer
+		transformerUsingForwardBlock:^(NSString *str, BOOL *success, NSError **error) {
+			forwardInvocations++;
+			return [NSURL URLWithString:str];
+		}
+		reverseBlock:^(NSURL *URL, BOOL *success, NSError **error) {
+			reverseInvocations++;
+			return URL.absoluteString;
+		}];
+});
+
+it(@"should only invoke the transformer once per value", ^{
+	MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:countingTransformer countLimit:16];
+
+	NSURL *URL = [transformer transformedValue:@"https://github.com/"];
+	expect(URL).to(equal([NSURL URLWithString:@"https://github.com/"]));
+	expect([transformer transformedValue:@"https://github.com/"]).to(beIdenticalTo(URL));
+	expect([transformer transformedValue:@"https://github.com/Mantle"]).to(equal([NSURL URLWithString:@"https://github.com/Mantle"]));
+
+	expect(@(forwardInvocations)).to(equal(@2));
+	expect(@(transformer.hitCount)).to(equal(@1));
+	expect(@(transformer.missCount)).to(equal(@2));
+});
+
+it(@"should remember reverse transformations separately", ^{
+	MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:countingTransformer countLimit:16];
+	expect(@([transformer.class allowsReverseTransformation])).to(beTruthy());
+
+	NSURL *URL = [NSURL URLWithString:@"https://github.com/"];
+	expect([transformer reverseTransformedValue:URL]).to(equal(@"https://github.com/"));
+	expect([transformer reverseTransformedValue:URL]).to(equal(@"https://github.com/"));
+
+	expect(@(reverseInvocations)).to(equal(@1));
+	expect(@(forwardInvocations)).to(equal(@0));
+});
+
+it(@"should discard the least recently used value", ^{
+	MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:countingTransformer countLimit:1];
+
+	[transformer transformedValue:@"https://github.com/"];
+	[transformer transformedValue:@"https://github.com/Mantle"];
+	[transformer transformedValue:@"https://github.com/"];
+
+	expect(@(forwardInvocations)).to(equal(@3));
+	expect(@(transformer.hitCount)).to(equal(@0));
+});
+
+it(@"should not hold more than countLimit values in total", ^{
+	for (NSNumber *countLimit in @[ @1, @7, @8, @10, @17 ]) {
+		MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:countingTransformer countLimit:countLimit.unsignedIntegerValue];
+
+		expect([transformer valueForKeyPath:@"forwardShards.@sum.countLimit"]).to(equal(countLimit));
+		expect([transformer valueForKeyPath:@"reverseShards.@sum.countLimit"]).to(equal(countLimit));
+	}
+});
+
+it(@"should forget all values when asked to", ^{
+	MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:countingTransformer countLimit:16];
+
+	[transformer transformedValue:@"https://github.com/"];
+	[transformer removeAllCachedValues];
+	[transformer transformedValue:@"https://github.com/"];
+
+	expect(@(forwardInvocations)).to(equal(@2));
+});
+
+it(@"should not allow reverse transformation of a forward transformer", ^{
+	NSValueTransformer *forwardTransformer = [MTLValueTransformer transformerUsingForwardBlock:^(NSString *str, BOOL *success, NSError **error) {
+		return [NSURL URLWithString:str];
+	}];
+
+	MTLMemoizingValueTransformer *transformer = [MTLMemoizingValueTransformer transformerWithTransformer:forwardTransformer countLimit:16];
+	expect(@([transformer.class allowsReverseTransformation])).to(beFalsy());
+});
+
+describe(@"wrapping an error handling transformer", ^{
+	__block MTLMemoizingValueTransformer *transformer;
+
+	beforeEach(^{
+		transformer = [MTLMemoizingValueTransformer transformerWithTransformer:[NSValueTransformer valueTransformerForName:MTLURLValueTransformerName] countLimit:16];
+	});
+
+	it(@"should not remember failed transformations", ^{
+		__block NSError *error;
+		__block BOOL success = YES;
+
+		expect([transformer transformedValue:@"not a valid URL" success:&success error:&error]).to(beNil());
+		expect(@(success)).to(beFalsy());
+
+		error = nil;
+		success = YES;
+
+		expect([transformer transformedValue:@"not a valid URL" success:&success error:&error]).to(beNil());
+		expect(@(success)).to(beFalsy());
+		expect(error).notTo(beNil());
+	});
+
+	itBehavesLike(MTLTransformerErrorExamples, ^{
+		return @{
+			MTLTransformerErrorExamplesTransformer: transformer,
+			MTLTransformerErrorExamplesInvalidTransformationInput: @"not a valid URL",
+			MTLTransformerErrorExamplesInvalidReverseTransformationInput: NSNull.null
+		};
+	});
+});
+
+QuickSpecEnd
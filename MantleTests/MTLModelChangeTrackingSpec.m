@@ -0,0 +1,122 @@
+//
+//  MTLModelChangeTrackingSpec.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLModelChangeTracking)
+
+__block MTLChangeTrackingTestModel *model;
+
+beforeEach(^{
+	model = [MTLJSONAdapter modelOfClass:MTLChangeTrackingTestModel.class fromJSONDictionary:@{
+		@"name": @"foo",
+		@"count": @1,
+		@"owner": @{ @"name": @"bar", @"count": @2 }
+	} error:NULL];
+
+	expect(model).notTo(beNil());
+});
+
+it(@"should have no changes after decoding", ^{
+	expect(model.changedKeyPaths).to(equal(@[]));
+	expect(@(model.hasChanges)).to(beFalsy());
+	expect(@(model.owner.hasChanges)).to(beFalsy());
+});
+
+it(@"should report all properties of models which were never checkpointed", ^{
+	MTLChangeTrackingTestModel *newModel = [[MTLChangeTrackingTestModel alloc] init];
+	expect(newModel.changedKeyPaths).to(equal(@[ @"count", @"name", @"owner", @"tags" ]));
+});
+
+it(@"should report changed properties", ^{
+	model.count = 3;
+	model.name = @"baz";
+
+	expect(model.changedKeyPaths).to(equal(@[ @"count", @"name" ]));
+	expect(@(model.hasChanges)).to(beTruthy());
+});
+
+it(@"should not report properties set to an equal value", ^{
+	model.name = [@"fo" stringByAppendingString:@"o"];
+	model.count = 1;
+
+	expect(@(model.hasChanges)).to(beFalsy());
+});
+
+it(@"should report the changes of nested models", ^{
+	model.owner.count = 5;
+
+	expect(model.changedKeyPaths).to(equal(@[ @"owner.count" ]));
+	expect(model.owner.changedKeyPaths).to(equal(@[ @"count" ]));
+});
+
+it(@"should report replaced nested models as a whole", ^{
+	model.owner = [MTLChangeTrackingTestModel modelWithDictionary:@{ @"name": @"bar", @"count": @2 } error:NULL];
+
+	expect(model.changedKeyPaths).to(equal(@[ @"owner" ]));
+});
+
+it(@"should report collections mutated in place", ^{
+	model.tags = [NSMutableArray arrayWithObject:@"foo"];
+	[model checkpointChanges];
+
+	[model.tags addObject:@"bar"];
+
+	expect(model.changedKeyPaths).to(equal(@[ @"tags" ]));
+});
+
+it(@"should forget changes when checkpointed", ^{
+	model.name = @"baz";
+	model.owner.count = 5;
+
+	[model checkpointChanges];
+
+	expect(@(model.hasChanges)).to(beFalsy());
+	expect(@(model.owner.hasChanges)).to(beFalsy());
+});
+
+describe(@"serializing changes only", ^{
+	__block MTLJSONAdapter *adapter;
+
+	beforeEach(^{
+		adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLChangeTrackingTestModel.class];
+		adapter.serializesChangesOnly = YES;
+	});
+
+	it(@"should serialize nothing without changes", ^{
+		NSError *error = nil;
+		expect([adapter JSONDictionaryFromModel:model error:&error]).to(equal(@{}));
+		expect(error).to(beNil());
+	});
+
+	it(@"should serialize only changed properties", ^{
+		model.name = nil;
+		model.owner.count = 5;
+
+		NSDictionary *JSONDictionary = [adapter JSONDictionaryFromModel:model error:NULL];
+		expect(JSONDictionary).to(equal(@{
+			@"name": NSNull.null,
+			@"owner": @{ @"count": @5 }
+		}));
+	});
+
+	it(@"should serialize replaced nested models in full", ^{
+		model.owner = [MTLChangeTrackingTestModel modelWithDictionary:@{ @"name": @"qux" } error:NULL];
+
+		NSDictionary *JSONDictionary = [adapter JSONDictionaryFromModel:model error:NULL];
+		expect(JSONDictionary).to(equal(@{
+			@"owner": @{ @"name": @"qux", @"count": @0 }
+		}));
+	});
+});
+
+QuickSpecEnd
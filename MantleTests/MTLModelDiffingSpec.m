@@ -0,0 +1,79 @@
+//
+//  MTLModelDiffingSpec.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLModelDiffing)
+
+__block MTLTestModel *oldModel;
+__block MTLTestModel *newModel;
+
+beforeEach(^{
+	oldModel = [MTLTestModel modelWithDictionary:@{
+		@"name": @"foo",
+		@"count": @5,
+		@"nestedName": @"bar"
+	} error:NULL];
+	expect(oldModel).notTo(beNil());
+
+	newModel = [oldModel copy];
+});
+
+it(@"should return no key paths for equal models", ^{
+	expect([newModel changedKeyPathsFromModel:oldModel]).to(equal(@[]));
+	expect([oldModel changedKeyPathsFromModel:oldModel]).to(equal(@[]));
+});
+
+it(@"should return the keys of changed properties in order", ^{
+	newModel.nestedName = @"baz";
+	newModel.count = 6;
+
+	expect([newModel changedKeyPathsFromModel:oldModel]).to(equal(@[ @"count", @"nestedName" ]));
+});
+
+it(@"should return the key paths of changed properties of nested models", ^{
+	MTLPropertyDefaultAdapterModel *oldParent = [MTLPropertyDefaultAdapterModel modelWithDictionary:@{
+		@"property": @"property",
+		@"conformingMTLJSONSerializingProperty": oldModel
+	} error:NULL];
+
+	MTLPropertyDefaultAdapterModel *newParent = [oldParent copy];
+	expect([newParent changedKeyPathsFromModel:oldParent]).to(equal(@[]));
+
+	newModel.name = @"qux";
+	newParent.conformingMTLJSONSerializingProperty = newModel;
+	newParent.property = @"changed";
+
+	expect([newParent changedKeyPathsFromModel:oldParent]).to(equal(@[ @"conformingMTLJSONSerializingProperty.name", @"property" ]));
+});
+
+it(@"should skip equal immutable models with matching hashes", ^{
+	NSDictionary *ownerValues = @{ @"firstName": @"foo", @"count": @1 };
+
+	MTLInterningTestModel *oldParent = [MTLInterningTestModel modelWithDictionary:@{
+		@"owner": [MTLImmutableTestModel modelWithDictionary:ownerValues error:NULL]
+	} error:NULL];
+
+	MTLInterningTestModel *newParent = [MTLInterningTestModel modelWithDictionary:@{
+		@"owner": [MTLImmutableTestModel modelWithDictionary:ownerValues error:NULL]
+	} error:NULL];
+
+	expect(newParent.owner).notTo(beIdenticalTo(oldParent.owner));
+	expect(@(newParent.owner.hash)).to(equal(@(oldParent.owner.hash)));
+
+	expect([newParent changedKeyPathsFromModel:oldParent]).to(equal(@[]));
+
+	newParent.owner = [MTLImmutableTestModel modelWithDictionary:@{ @"firstName": @"foo", @"count": @2 } error:NULL];
+	expect([newParent changedKeyPathsFromModel:oldParent]).to(equal(@[ @"owner.count" ]));
+});
+
+QuickSpecEnd
@@ -0,0 +1,175 @@
+//
+//  MTLModelFingerprintingSpec.m
+//  Mantle
+//
+//  Created by the Mantle contributors on 2026-10-18.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+typedef struct {
+	char flag;
+	double value;
+} MTLFingerprintPaddedStruct;
+
+// Returns the name of the exception raised while fingerprinting `model`, or nil
+// if none is raised.
+static NSString *MTLFingerprintExceptionName(MTLModel *model) {
+	@try {
+		[model contentFingerprint];
+		return nil;
+	} @catch (NSException *ex) {
+		return ex.name;
+	}
+}
+
+static NSString *MTLHexStringFromData(NSData *data) {
+	NSMutableString *string = [NSMutableString stringWithCapacity:data.length * 2];
+	const uint8_t *bytes = data.bytes;
+
+	for (NSUInteger i = 0; i < data.length; i++) {
+		[string appendFormat:@"%02x", bytes[i]];
+	}
+
+	return string;
+}
+
+QuickSpecBegin(MTLModelFingerprinting)
+
+__block MTLImmutableTestModel *model;
+
+beforeEach(^{
+	model = [MTLImmutableTestModel modelWithDictionary:@{
+		@"firstName": @"foo",
+		@"count": @5,
+		@"ratio": @0.5
+	} error:NULL];
+
+	expect(model).notTo(beNil());
+});
+
+it(@"should produce a stable 128-bit fingerprint", ^{
+	NSData *fingerprint = model.contentFingerprint;
+
+	expect(@(fingerprint.length)).to(equal(@(MTLModelFingerprintLength)));
+	expect(MTLHexStringFromData(fingerprint)).to(equal(@"5a5e9e4bcea1f3c2d799074fa348a9ab"));
+});
+
+it(@"should produce equal fingerprints for equal models", ^{
+	MTLImmutableTestModel *matchingModel = [model copy];
+	MTLImmutableTestModel *differentModel = [MTLImmutableTestModel modelWithDictionary:@{
+		@"firstName": @"foo",
+		@"count": @6,
+		@"ratio": @0.5
+	} error:NULL];
+
+	expect(matchingModel.contentFingerprint).to(equal(model.contentFingerprint));
+	expect(differentModel.contentFingerprint).notTo(equal(model.contentFingerprint));
+});
+
+it(@"should distinguish models of different classes", ^{
+	MTLStringModel *stringModel = [MTLStringModel modelWithDictionary:@{ @"string": @"foo" } error:NULL];
+	MTLIDModel *IDModel = [MTLIDModel modelWithDictionary:@{ @"anyObject": @"foo" } error:NULL];
+
+	expect(stringModel.contentFingerprint).notTo(equal(IDModel.contentFingerprint));
+});
+
+it(@"should encode numbers which compare equal the same", ^{
+	MTLIDModel *integerModel = [MTLIDModel modelWithDictionary:@{ @"anyObject": @1 } error:NULL];
+	MTLIDModel *doubleModel = [MTLIDModel modelWithDictionary:@{ @"anyObject": @1.0 } error:NULL];
+	MTLIDModel *booleanModel = [MTLIDModel modelWithDictionary:@{ @"anyObject": @YES } error:NULL];
+
+	expect(integerModel.contentFingerprint).to(equal(doubleModel.contentFingerprint));
+	expect(integerModel.contentFingerprint).notTo(equal(booleanModel.contentFingerprint));
+});
+
+it(@"should recurse into nested collections and models", ^{
+	MTLImmutableTestModel *otherModel = [MTLImmutableTestModel modelWithDictionary:@{ @"firstName": @"bar" } error:NULL];
+
+	MTLIDModel *graph = [MTLIDModel modelWithDictionary:@{
+		@"anyObject": @{
+			@"models": @[ model, otherModel ],
+			@"tags": [NSSet setWithObjects:@"a", @"b", @"c", nil],
+			@"count": @2
+		}
+	} error:NULL];
+
+	NSMutableDictionary *reordered = [NSMutableDictionary dictionary];
+	reordered[@"count"] = @2;
+	reordered[@"tags"] = [NSSet setWithObjects:@"c", @"b", @"a", nil];
+	reordered[@"models"] = @[ [model copy], [otherModel copy] ];
+
+	MTLIDModel *matchingGraph = [MTLIDModel modelWithDictionary:@{ @"anyObject": reordered } error:NULL];
+	expect(matchingGraph.contentFingerprint).to(equal(graph.contentFingerprint));
+
+	MTLIDModel *swappedGraph = [MTLIDModel modelWithDictionary:@{
+		@"anyObject": @{
+			@"models": @[ otherModel, model ],
+			@"tags": [NSSet setWithObjects:@"a", @"b", @"c", nil],
+			@"count": @2
+		}
+	} error:NULL];
+
+	expect(swappedGraph.contentFingerprint).notTo(equal(graph.contentFingerprint));
+});
+
+it(@"should encode structs field by field", ^{
+	MTLFingerprintPaddedStruct zeroedStruct;
+	memset(&zeroedStruct, 0, sizeof(zeroedStruct));
+	zeroedStruct.flag = 1;
+	zeroedStruct.value = 0.5;
+
+	MTLFingerprintPaddedStruct filledStruct;
+	memset(&filledStruct, 0xFF, sizeof(filledStruct));
+	filledStruct.flag = 1;
+	filledStruct.value = 0.5;
+
+	MTLIDModel *zeroedModel = [MTLIDModel modelWithDictionary:@{ @"anyObject": [NSValue valueWithBytes:&zeroedStruct objCType:@encode(MTLFingerprintPaddedStruct)] } error:NULL];
+	MTLIDModel *filledModel = [MTLIDModel modelWithDictionary:@{ @"anyObject": [NSValue valueWithBytes:&filledStruct objCType:@encode(MTLFingerprintPaddedStruct)] } error:NULL];
+	expect(filledModel.contentFingerprint).to(equal(zeroedModel.contentFingerprint));
+
+	filledStruct.value = 0.25;
+	MTLIDModel *differentModel = [MTLIDModel modelWithDictionary:@{ @"anyObject": [NSValue valueWithBytes:&filledStruct objCType:@encode(MTLFingerprintPaddedStruct)] } error:NULL];
+	expect(differentModel.contentFingerprint).notTo(equal(zeroedModel.contentFingerprint));
+
+	MTLIDModel *rangeModel = [MTLIDModel modelWithDictionary:@{ @"anyObject": [NSValue valueWithRange:NSMakeRange(1, 2)] } error:NULL];
+	MTLIDModel *otherRangeModel = [MTLIDModel modelWithDictionary:@{ @"anyObject": [NSValue valueWithRange:NSMakeRange(2, 1)] } error:NULL];
+	expect(rangeModel.contentFingerprint).notTo(equal(otherRangeModel.contentFingerprint));
+});
+
+it(@"should raise for values which cannot be encoded by value", ^{
+	MTLIDModel *objectModel = [MTLIDModel modelWithDictionary:@{ @"anyObject": [[NSObject alloc] init] } error:NULL];
+	expect(MTLFingerprintExceptionName(objectModel)).to(equal(NSInvalidArgumentException));
+
+	MTLIDModel *pointerModel = [MTLIDModel modelWithDictionary:@{ @"anyObject": [NSValue valueWithPointer:objectModel] } error:NULL];
+	expect(MTLFingerprintExceptionName(pointerModel)).to(equal(NSInvalidArgumentException));
+});
+
+it(@"should compute the fingerprint of immutable models only once", ^{
+	expect(model.contentFingerprint).to(beIdenticalTo(model.contentFingerprint));
+});
+
+it(@"should discard the fingerprint of immutable models set through key-value coding", ^{
+	NSData *fingerprint = model.contentFingerprint;
+
+	[model setValue:@"baz" forKey:@"firstName"];
+	expect(model.contentFingerprint).notTo(equal(fingerprint));
+});
+
+it(@"should recompute the fingerprint of mutable models", ^{
+	MTLIDModel *mutableModel = [MTLIDModel modelWithDictionary:@{ @"anyObject": @"foo" } error:NULL];
+	NSData *fingerprint = mutableModel.contentFingerprint;
+
+	mutableModel.anyObject = @"bar";
+	expect(mutableModel.contentFingerprint).notTo(equal(fingerprint));
+
+	mutableModel.anyObject = @"foo";
+	expect(mutableModel.contentFingerprint).to(equal(fingerprint));
+});
+
+QuickSpecEnd
@@ -12,6 +12,30 @@
 
 #import "MTLTestModel.h"
 
+// Records the key paths it is notified about.
+@interface MTLModelSpecObserver : NSObject
+
+@property (nonatomic, strong, readonly) NSMutableArray *observedKeyPaths;
+
+@end
+
+@implementation MTLModelSpecObserver
+
+- (instancetype)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_observedKeyPaths = [NSMutableArray array];
+
+	return self;
+}
+
+- (void)observeValueForKeyPath:(NSString *)keyPath ofObject:(id)object change:(NSDictionary *)change context:(void *)context {
+	[self.observedKeyPaths addObject:keyPath];
+}
+
+@end
+
 QuickSpecBegin(MTLModelSpec)
 
 it(@"should not loop infinitely in +propertyKeys without any properties", ^{
@@ -161,6 +185,271 @@ it(@"should ignore optional protocol properties not implemented", ^{
 	expect(@([MTLOptionalPropertyModel storageBehaviorForPropertyWithKey:@"optionalImplementedProperty"])).to(equal(@(MTLPropertyStoragePermanent)));
 });
 
+describe(@"hashing and equality", ^{
+	MTLImmutableTestModel * (^immutableModel)(NSDictionary *) = ^(NSDictionary *values) {
+		MTLImmutableTestModel *model = [MTLImmutableTestModel modelWithDictionary:values error:NULL];
+		expect(model).notTo(beNil());
+
+		return model;
+	};
+
+	it(@"should hash models with swapped values differently", ^{
+		MTLImmutableTestModel *model = immutableModel(@{ @"firstName": @"foo", @"lastName": @"bar" });
+		MTLImmutableTestModel *swappedModel = immutableModel(@{ @"firstName": @"bar", @"lastName": @"foo" });
+
+		expect(model).notTo(equal(swappedModel));
+		expect(@(model.hash)).notTo(equal(@(swappedModel.hash)));
+	});
+
+	it(@"should not let equal values cancel each other out", ^{
+		MTLImmutableTestModel *model = immutableModel(@{ @"firstName": @"foo", @"lastName": @"foo" });
+		MTLImmutableTestModel *otherModel = immutableModel(@{ @"firstName": @"bar", @"lastName": @"bar" });
+
+		expect(@(model.hash)).notTo(equal(@(otherModel.hash)));
+	});
+
+	it(@"should compare primitive properties", ^{
+		MTLImmutableTestModel *model = immutableModel(@{ @"count": @5, @"ratio": @0.5 });
+
+		expect(model).to(equal(immutableModel(@{ @"count": @5, @"ratio": @0.5 })));
+		expect(model).notTo(equal(immutableModel(@{ @"count": @6, @"ratio": @0.5 })));
+		expect(model).notTo(equal(immutableModel(@{ @"count": @5, @"ratio": @0.25 })));
+	});
+
+	it(@"should hash equal floating-point values the same", ^{
+		MTLImmutableTestModel *positiveZero = immutableModel(@{ @"ratio": @0.0 });
+		MTLImmutableTestModel *negativeZero = immutableModel(@{ @"ratio": @(-0.0) });
+		expect(positiveZero).to(equal(negativeZero));
+		expect(@(positiveZero.hash)).to(equal(@(negativeZero.hash)));
+
+		MTLImmutableTestModel *notANumber = immutableModel(@{ @"ratio": @(NAN) });
+		MTLImmutableTestModel *otherNotANumber = immutableModel(@{ @"ratio": @(NAN) });
+		expect(notANumber).to(equal(otherNotANumber));
+		expect(@(notANumber.hash)).to(equal(@(otherNotANumber.hash)));
+	});
+
+	it(@"should compare immutable models after their hashes have been cached", ^{
+		NSDictionary *values = @{ @"firstName": @"foo", @"lastName": @"bar", @"count": @1 };
+		MTLImmutableTestModel *model = immutableModel(values);
+		MTLImmutableTestModel *matchingModel = immutableModel(values);
+		MTLImmutableTestModel *differentModel = immutableModel(@{ @"firstName": @"foo", @"lastName": @"bar", @"count": @2 });
+
+		NSSet *models = [NSSet setWithObjects:model, differentModel, nil];
+		expect(@(models.count)).to(equal(@2));
+		expect(@([models containsObject:matchingModel])).to(beTruthy());
+
+		expect(model).to(equal(matchingModel));
+		expect(model).notTo(equal(differentModel));
+	});
+
+	it(@"should discard the hash of immutable models set through key-value coding", ^{
+		MTLImmutableTestModel *model = immutableModel(@{ @"firstName": @"foo" });
+		NSUInteger hash = model.hash;
+
+		[model setValue:@"bar" forKey:@"firstName"];
+		expect(@(model.hash)).to(equal(@(immutableModel(@{ @"firstName": @"bar" }).hash)));
+
+		[model mergeValuesForKeysFromModel:immutableModel(@{ @"firstName": @"foo" })];
+		expect(@(model.hash)).to(equal(@(hash)));
+	});
+
+	it(@"should recompute the hash of immutable models holding mutable models", ^{
+		MTLTestModel *nestedModel = [MTLTestModel modelWithDictionary:@{ @"name": @"foo" } error:NULL];
+		MTLImmutableWrapperTestModel *model = [MTLImmutableWrapperTestModel modelWithDictionary:@{ @"value": nestedModel } error:NULL];
+		NSUInteger hash = model.hash;
+
+		nestedModel.name = @"bar";
+
+		MTLTestModel *changedModel = [MTLTestModel modelWithDictionary:@{ @"name": @"bar" } error:NULL];
+		MTLImmutableWrapperTestModel *matchingModel = [MTLImmutableWrapperTestModel modelWithDictionary:@{ @"value": changedModel } error:NULL];
+
+		expect(@(model.hash)).notTo(equal(@(hash)));
+		expect(@(model.hash)).to(equal(@(matchingModel.hash)));
+		expect(model).to(equal(matchingModel));
+	});
+
+	it(@"should recompute the hash of mutable models", ^{
+		MTLTestModel *model = [MTLTestModel modelWithDictionary:@{ @"name": @"foo" } error:NULL];
+		NSUInteger hash = model.hash;
+
+		model.name = @"bar";
+		expect(@(model.hash)).notTo(equal(@(hash)));
+
+		model.name = @"foo";
+		expect(@(model.hash)).to(equal(@(hash)));
+	});
+});
+
+describe(@"copying", ^{
+	it(@"should return immutable models themselves", ^{
+		MTLImmutableTestModel *model = [MTLImmutableTestModel modelWithDictionary:@{ @"firstName": @"foo", @"count": @2 } error:NULL];
+
+		expect([model copy]).to(beIdenticalTo(model));
+	});
+
+	it(@"should copy every property of mutable models", ^{
+		MTLEmptyTestModel *emptyModel = [[MTLEmptyTestModel alloc] init];
+		MTLTestModel *model = [MTLTestModel modelWithDictionary:@{
+			@"name": @"foo",
+			@"count": @7,
+			@"nestedName": @"bar",
+			@"weakModel": emptyModel
+		} error:NULL];
+
+		MTLTestModel *copiedModel = [model copy];
+		expect(copiedModel).notTo(beIdenticalTo(model));
+		expect(copiedModel.name).to(equal(@"foo"));
+		expect(@(copiedModel.count)).to(equal(@7));
+		expect(copiedModel.nestedName).to(equal(@"bar"));
+		expect(copiedModel.weakModel).to(beIdenticalTo(emptyModel));
+	});
+
+	it(@"should copy properties with struct types", ^{
+		MTLMultiKeypathModel *model = [MTLMultiKeypathModel modelWithDictionary:@{
+			@"range": [NSValue valueWithRange:NSMakeRange(1, 2)],
+			@"nestedRange": [NSValue valueWithRange:NSMakeRange(3, 4)]
+		} error:NULL];
+
+		MTLMultiKeypathModel *copiedModel = [model copy];
+		expect(copiedModel).to(equal(model));
+		expect(@(NSEqualRanges(copiedModel.range, NSMakeRange(1, 2)))).to(beTruthy());
+	});
+});
+
+describe(@"compact storage", ^{
+	__block MTLCompactTestModel *model;
+
+	beforeEach(^{
+		model = [[MTLCompactTestModel alloc] init];
+	});
+
+	it(@"should default to nil and zero", ^{
+		expect(model.name).to(beNil());
+		expect(model.tags).to(beNil());
+		expect(@(model.enabled)).to(beFalsy());
+		expect(@(model.level)).to(equal(@0));
+		expect(@(model.count)).to(equal(@0));
+		expect(@(model.ratio)).to(equal(@0));
+	});
+
+	it(@"should store objects", ^{
+		model.tags = @[ @"a" ];
+		model.name = @"foo";
+		model.URL = [NSURL URLWithString:@"http://github.com"];
+
+		expect(model.name).to(equal(@"foo"));
+		expect(model.tags).to(equal(@[ @"a" ]));
+		expect(model.URL).to(equal([NSURL URLWithString:@"http://github.com"]));
+
+		model.tags = nil;
+		expect(model.tags).to(beNil());
+		expect(model.name).to(equal(@"foo"));
+		expect(model.URL).to(equal([NSURL URLWithString:@"http://github.com"]));
+
+		model.name = @"bar";
+		expect(model.name).to(equal(@"bar"));
+	});
+
+	it(@"should copy values of copy properties", ^{
+		NSMutableString *name = [NSMutableString stringWithString:@"foo"];
+		model.name = name;
+		[name appendString:@"bar"];
+
+		expect(model.name).to(equal(@"foo"));
+	});
+
+	it(@"should store numbers and booleans without affecting each other", ^{
+		model.enabled = YES;
+		model.level = -3;
+		model.count = NSIntegerMin;
+		model.ratio = -0.25;
+
+		expect(@(model.enabled)).to(beTruthy());
+		expect(@(model.hidden)).to(beFalsy());
+		expect(@(model.level)).to(equal(@(-3)));
+		expect(@(model.count)).to(equal(@(NSIntegerMin)));
+		expect(@(model.ratio)).to(equal(@(-0.25)));
+
+		model.hidden = YES;
+		model.enabled = NO;
+
+		expect(@(model.enabled)).to(beFalsy());
+		expect(@(model.hidden)).to(beTruthy());
+		expect(@(model.level)).to(equal(@(-3)));
+	});
+
+	it(@"should support key-value coding", ^{
+		[model setValue:@"foo" forKey:@"name"];
+		[model setValue:@12 forKey:@"count"];
+
+		expect([model valueForKey:@"name"]).to(equal(@"foo"));
+		expect([model valueForKey:@"count"]).to(equal(@12));
+	});
+
+	it(@"should include compactly stored properties in +propertyKeys", ^{
+		NSSet *expectedKeys = [NSSet setWithObjects:@"name", @"tags", @"URL", @"enabled", @"hidden", @"level", @"count", @"ratio", nil];
+		expect(MTLCompactTestModel.propertyKeys).to(equal(expectedKeys));
+	});
+
+	it(@"should compare, hash, copy and describe compactly stored properties", ^{
+		model.name = @"foo";
+		model.count = 5;
+		model.enabled = YES;
+
+		MTLCompactTestModel *copiedModel = [model copy];
+		expect(copiedModel).notTo(beIdenticalTo(model));
+		expect(copiedModel).to(equal(model));
+		expect(@(copiedModel.hash)).to(equal(@(model.hash)));
+
+		expect(model.dictionaryValue[@"name"]).to(equal(@"foo"));
+		expect(model.dictionaryValue[@"count"]).to(equal(@5));
+		expect(model.dictionaryValue[@"tags"]).to(equal(NSNull.null));
+
+		copiedModel.enabled = NO;
+		expect(copiedModel).notTo(equal(model));
+	});
+
+	it(@"should store properties of subclasses after those of superclasses", ^{
+		MTLCompactSubclassTestModel *subclassModel = [[MTLCompactSubclassTestModel alloc] init];
+		subclassModel.role = @"admin";
+		subclassModel.rank = 65535;
+		subclassModel.name = @"foo";
+		subclassModel.tags = @[ @"a", @"b" ];
+		subclassModel.level = 127;
+
+		// Install the superclass accessors through an instance of the
+		// superclass too.
+		model.name = @"bar";
+
+		expect(subclassModel.role).to(equal(@"admin"));
+		expect(@(subclassModel.rank)).to(equal(@65535));
+		expect(subclassModel.name).to(equal(@"foo"));
+		expect(subclassModel.tags).to(equal(@[ @"a", @"b" ]));
+		expect(@(subclassModel.level)).to(equal(@127));
+		expect(model.name).to(equal(@"bar"));
+	});
+
+	it(@"should round trip through JSON", ^{
+		NSDictionary *JSONDictionary = @{
+			@"name": @"foo",
+			@"tags": @[ @"a" ],
+			@"URL": @"http://github.com",
+			@"enabled": @YES,
+			@"hidden": @NO,
+			@"level": @2,
+			@"count": @3,
+			@"ratio": @0.5
+		};
+
+		NSError *error = nil;
+		MTLCompactTestModel *decodedModel = [MTLJSONAdapter modelOfClass:MTLCompactTestModel.class fromJSONDictionary:JSONDictionary error:&error];
+		expect(decodedModel).notTo(beNil());
+		expect(error).to(beNil());
+
+		expect([MTLJSONAdapter JSONDictionaryFromModel:decodedModel error:NULL]).to(equal(JSONDictionary));
+	});
+});
+
 describe(@"merging with model subclasses", ^{
 	__block MTLTestModel *superclass;
 	__block MTLSubclassTestModel *subclass;
@@ -198,6 +487,43 @@ describe(@"merging with model subclasses", ^{
 		expect(subclass.generation).to(equal(@1));
 		expect(subclass.role).to(equal(@"subclass"));
 	});
+
+	it(@"should merge repeatedly between the same classes", ^{
+		[superclass mergeValuesForKeysFromModel:subclass];
+		[superclass mergeValuesForKeysFromModel:subclass];
+
+		expect(superclass.name).to(equal(@"bar"));
+		expect(@(superclass.count)).to(equal(@11));
+	});
+
+	it(@"should notify observers of merged properties", ^{
+		MTLModelSpecObserver *observer = [[MTLModelSpecObserver alloc] init];
+		[superclass addObserver:observer forKeyPath:@"name" options:0 context:NULL];
+
+		[superclass mergeValuesForKeysFromModel:subclass];
+		[superclass removeObserver:observer forKeyPath:@"name"];
+
+		expect(superclass.name).to(equal(@"bar"));
+		expect(observer.observedKeyPaths).to(equal(@[ @"name" ]));
+	});
+
+	it(@"should merge compactly stored properties", ^{
+		MTLCompactTestModel *target = [[MTLCompactTestModel alloc] init];
+		target.name = @"foo";
+		target.count = 1;
+
+		MTLCompactSubclassTestModel *source = [[MTLCompactSubclassTestModel alloc] init];
+		source.tags = @[ @"a" ];
+		source.count = 2;
+		source.ratio = 0.5;
+
+		[target mergeValuesForKeysFromModel:source];
+
+		expect(target.name).to(beNil());
+		expect(target.tags).to(equal(@[ @"a" ]));
+		expect(@(target.count)).to(equal(@2));
+		expect(@(target.ratio)).to(equal(@0.5));
+	});
 });
 
 
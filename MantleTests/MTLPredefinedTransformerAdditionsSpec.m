@@ -90,6 +90,136 @@ describe(@"The number transformer", ^{
 	});
 });
 
+describe(@"The base64 data transformers", ^{
+	// Long enough to exercise both the vectorized and the scalar paths.
+	NSData *data = [@"Mantle makes it easy to write a simple model layer?>" dataUsingEncoding:NSUTF8StringEncoding];
+	NSString *standardString = @"TWFudGxlIG1ha2VzIGl0IGVhc3kgdG8gd3JpdGUgYSBzaW1wbGUgbW9kZWwgbGF5ZXI/Pg==";
+	NSString *URLString = @"TWFudGxlIG1ha2VzIGl0IGVhc3kgdG8gd3JpdGUgYSBzaW1wbGUgbW9kZWwgbGF5ZXI_Pg";
+
+	__block NSValueTransformer *standardTransformer;
+	__block NSValueTransformer *URLTransformer;
+
+	beforeEach(^{
+		standardTransformer = [NSValueTransformer valueTransformerForName:MTLBase64DataValueTransformerName];
+		URLTransformer = [NSValueTransformer valueTransformerForName:MTLBase64URLDataValueTransformerName];
+
+		expect(standardTransformer).notTo(beNil());
+		expect(URLTransformer).notTo(beNil());
+		expect(@([standardTransformer.class allowsReverseTransformation])).to(beTruthy());
+		expect(@([URLTransformer.class allowsReverseTransformation])).to(beTruthy());
+	});
+
+	it(@"should convert base64 strings to NSData and back", ^{
+		expect([standardTransformer transformedValue:standardString]).to(equal(data));
+		expect([standardTransformer reverseTransformedValue:data]).to(equal(standardString));
+
+		expect([URLTransformer transformedValue:URLString]).to(equal(data));
+		expect([URLTransformer reverseTransformedValue:data]).to(equal(URLString));
+
+		expect([standardTransformer transformedValue:@""]).to(equal([NSData data]));
+		expect([standardTransformer transformedValue:nil]).to(beNil());
+		expect([standardTransformer reverseTransformedValue:nil]).to(beNil());
+	});
+
+	it(@"should accept strings without padding", ^{
+		expect([standardTransformer transformedValue:@"TWFudGxl"]).to(equal([@"Mantle" dataUsingEncoding:NSUTF8StringEncoding]));
+		expect([standardTransformer transformedValue:@"TWFudA"]).to(equal([@"Mant" dataUsingEncoding:NSUTF8StringEncoding]));
+		expect([URLTransformer transformedValue:@"TWFudA=="]).to(equal([@"Mant" dataUsingEncoding:NSUTF8StringEncoding]));
+	});
+
+	it(@"should reject characters of the other alphabet", ^{
+		BOOL success = YES;
+		NSError *error = nil;
+		expect([(id)standardTransformer transformedValue:URLString success:&success error:&error]).to(beNil());
+		expect(@(success)).to(beFalsy());
+		expect(error.domain).to(equal(MTLTransformerErrorHandlingErrorDomain));
+		expect(error.userInfo[MTLTransformerErrorHandlingInputValueErrorKey]).to(equal(URLString));
+
+		success = YES;
+		expect([(id)URLTransformer transformedValue:standardString success:&success error:NULL]).to(beNil());
+		expect(@(success)).to(beFalsy());
+	});
+
+	itBehavesLike(MTLTransformerErrorExamples, ^{
+		return @{
+			MTLTransformerErrorExamplesTransformer: standardTransformer,
+			MTLTransformerErrorExamplesInvalidTransformationInput: @"not base64!",
+			MTLTransformerErrorExamplesInvalidReverseTransformationInput: NSNull.null
+		};
+	});
+});
+
+describe(@"The hexadecimal data transformer", ^{
+	__block NSValueTransformer *transformer;
+
+	beforeEach(^{
+		transformer = [NSValueTransformer valueTransformerForName:MTLHexDataValueTransformerName];
+
+		expect(transformer).notTo(beNil());
+		expect(@([transformer.class allowsReverseTransformation])).to(beTruthy());
+	});
+
+	it(@"should convert hexadecimal strings to NSData and back", ^{
+		const uint8_t bytes[] = { 0x00, 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10, 0xff };
+		NSData *data = [NSData dataWithBytes:bytes length:sizeof(bytes)];
+
+		expect([transformer transformedValue:@"000123456789abcdeffedcba9876543210ff"]).to(equal(data));
+		expect([transformer transformedValue:@"000123456789ABCDEFFEDCBA9876543210FF"]).to(equal(data));
+		expect([transformer reverseTransformedValue:data]).to(equal(@"000123456789abcdeffedcba9876543210ff"));
+
+		expect([transformer transformedValue:nil]).to(beNil());
+		expect([transformer reverseTransformedValue:nil]).to(beNil());
+	});
+
+	it(@"should reject strings of an odd length", ^{
+		BOOL success = YES;
+		expect([(id)transformer transformedValue:@"abc" success:&success error:NULL]).to(beNil());
+		expect(@(success)).to(beFalsy());
+	});
+
+	itBehavesLike(MTLTransformerErrorExamples, ^{
+		return @{
+			MTLTransformerErrorExamplesTransformer: transformer,
+			MTLTransformerErrorExamplesInvalidTransformationInput: @"0123456789abcdefg0",
+			MTLTransformerErrorExamplesInvalidReverseTransformationInput: NSNull.null
+		};
+	});
+});
+
+describe(@"The UUID transformer", ^{
+	__block NSValueTransformer *transformer;
+
+	beforeEach(^{
+		transformer = [NSValueTransformer valueTransformerForName:MTLUUIDValueTransformerName];
+
+		expect(transformer).notTo(beNil());
+		expect(@([transformer.class allowsReverseTransformation])).to(beTruthy());
+	});
+
+	it(@"should convert UUID strings to NSUUIDs and back", ^{
+		NSUUID *UUID = [[NSUUID alloc] initWithUUIDString:@"E621E1F8-C36C-495A-93FC-0C247A3E6E5F"];
+
+		expect([transformer transformedValue:@"E621E1F8-C36C-495A-93FC-0C247A3E6E5F"]).to(equal(UUID));
+		expect([transformer transformedValue:@"e621e1f8-c36c-495a-93fc-0c247a3e6e5f"]).to(equal(UUID));
+		expect([transformer reverseTransformedValue:UUID]).to(equal(@"e621e1f8-c36c-495a-93fc-0c247a3e6e5f"));
+
+		expect([transformer transformedValue:nil]).to(beNil());
+		expect([transformer reverseTransformedValue:nil]).to(beNil());
+	});
+
+	it(@"should be used for NSUUID properties by MTLJSONAdapter", ^{
+		expect([MTLJSONAdapter transformerForModelPropertiesOfClass:NSUUID.class]).to(beIdenticalTo(transformer));
+	});
+
+	itBehavesLike(MTLTransformerErrorExamples, ^{
+		return @{
+			MTLTransformerErrorExamplesTransformer: transformer,
+			MTLTransformerErrorExamplesInvalidTransformationInput: @"E621E1F8C36C495A93FC0C247A3E6E5F",
+			MTLTransformerErrorExamplesInvalidReverseTransformationInput: NSNull.null
+		};
+	});
+});
+
 describe(@"+mtl_arrayMappingTransformerWithTransformer:", ^{
 	__block NSValueTransformer *transformer;
 
@@ -151,6 +281,90 @@ describe(@"+mtl_arrayMappingTransformerWithTransformer:", ^{
 	});
 });
 
+describe(@"+mtl_transformerByComposingTransformers:", ^{
+	__block NSValueTransformer<MTLTransformerErrorHandling> *transformer;
+
+	NSValueTransformer *numberTransformer = [NSValueTransformer mtl_numberTransformerWithNumberStyle:NSNumberFormatterDecimalStyle locale:[NSLocale localeWithLocaleIdentifier:@"en_US"]];
+	NSValueTransformer *booleanTransformer = [NSValueTransformer valueTransformerForName:MTLBooleanValueTransformerName];
+
+	beforeEach(^{
+		transformer = [NSValueTransformer mtl_transformerByComposingTransformers:@[ numberTransformer, booleanTransformer ]];
+		expect(transformer).notTo(beNil());
+	});
+
+	it(@"should apply each transformer in order", ^{
+		expect([transformer transformedValue:@"1"]).to(beIdenticalTo((id)kCFBooleanTrue));
+		expect([transformer transformedValue:@"0"]).to(beIdenticalTo((id)kCFBooleanFalse));
+	});
+
+	it(@"should apply each reverse transformation in the opposite order", ^{
+		expect(@([transformer.class allowsReverseTransformation])).to(beTruthy());
+
+		expect([transformer reverseTransformedValue:@YES]).to(equal(@"1"));
+		expect([transformer reverseTransformedValue:@NO]).to(equal(@"0"));
+	});
+
+	it(@"should transform nil to nil", ^{
+		expect([transformer transformedValue:nil]).to(beNil());
+		expect([transformer reverseTransformedValue:nil]).to(beNil());
+	});
+
+	it(@"should pass nil intermediate results on", ^{
+		__block NSUInteger invocations = 0;
+		NSValueTransformer *nilTransformer = [MTLValueTransformer transformerUsingForwardBlock:^ id (id value, BOOL *success, NSError **error) {
+			return nil;
+		}];
+		NSValueTransformer *countingTransformer = [MTLValueTransformer transformerUsingForwardBlock:^(id value, BOOL *success, NSError **error) {
+			invocations++;
+			return value;
+		}];
+
+		transformer = [NSValueTransformer mtl_transformerByComposingTransformers:@[ nilTransformer, countingTransformer ]];
+
+		expect([transformer transformedValue:@"foo"]).to(beNil());
+		expect(@(invocations)).to(equal(@1));
+	});
+
+	it(@"should apply transformers which map nil to a value", ^{
+		NSValueTransformer *mappingTransformer = [NSValueTransformer mtl_valueMappingTransformerWithDictionary:@{ @"foo": @"bar" } defaultValue:@"default" reverseDefaultValue:nil];
+		NSValueTransformer *uppercaseTransformer = [MTLValueTransformer transformerUsingForwardBlock:^(NSString *value, BOOL *success, NSError **error) {
+			return value.uppercaseString;
+		}];
+
+		transformer = [NSValueTransformer mtl_transformerByComposingTransformers:@[ mappingTransformer, uppercaseTransformer ]];
+
+		expect([transformer transformedValue:nil]).to(equal(@"DEFAULT"));
+		expect([transformer transformedValue:@"foo"]).to(equal(@"BAR"));
+	});
+
+	it(@"should flatten nested compositions", ^{
+		NSValueTransformer *nested = [NSValueTransformer mtl_transformerByComposingTransformers:@[ transformer, booleanTransformer ]];
+
+		expect([nested transformedValue:@"1"]).to(beIdenticalTo((id)kCFBooleanTrue));
+		expect([nested reverseTransformedValue:@YES]).to(equal(@"1"));
+		expect([nested.mtl_invertedTransformer transformedValue:@NO]).to(equal(@"0"));
+	});
+
+	it(@"should not allow reverse transformation if any transformer does not", ^{
+		NSValueTransformer *forwardOnly = [MTLValueTransformer transformerUsingForwardBlock:^(id value, BOOL *success, NSError **error) {
+			return value;
+		}];
+
+		transformer = [NSValueTransformer mtl_transformerByComposingTransformers:@[ numberTransformer, forwardOnly ]];
+
+		expect(@([transformer.class allowsReverseTransformation])).to(beFalsy());
+		expect([transformer transformedValue:@"12"]).to(equal(@12));
+	});
+
+	itBehavesLike(MTLTransformerErrorExamples, ^{
+		return @{
+			MTLTransformerErrorExamplesTransformer: transformer,
+			MTLTransformerErrorExamplesInvalidTransformationInput: NSNull.null,
+			MTLTransformerErrorExamplesInvalidReverseTransformationInput: NSNull.null
+		};
+	});
+});
+
 describe(@"value mapping transformer", ^{
 	__block NSValueTransformer *transformer;
 
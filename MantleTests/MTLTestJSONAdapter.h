@@ -15,3 +15,8 @@
 @property (readwrite, nonatomic, strong) NSSet *ignoredPropertyKeys;
 
 @end
+
+// Decodes NSString properties without a transformer of their own as
+// uppercase strings.
+@interface MTLUppercasingJSONAdapter : MTLJSONAdapter
+@end
@@ -26,3 +26,13 @@
 }
 
 @end
+
+@implementation MTLUppercasingJSONAdapter
+
++ (NSValueTransformer *)NSStringJSONTransformer {
+	return [MTLValueTransformer transformerUsingForwardBlock:^(NSString *string, BOOL *success, NSError **error) {
+		return string.uppercaseString;
+	}];
+}
+
+@end
@@ -213,3 +213,111 @@ extern const NSInteger MTLTestModelNameMissing;
 @property (readwrite, nonatomic, strong) NSString *property;
 
 @end
+
+@interface MTLImmutableTestModel : MTLModel <MTLJSONSerializing>
+
+@property (nonatomic, copy, readonly) NSString *firstName;
+@property (nonatomic, copy, readonly) NSString *lastName;
+@property (nonatomic, assign, readonly) NSInteger count;
+@property (nonatomic, assign, readonly) double ratio;
+
+@end
+
+@interface MTLImmutableWrapperTestModel : MTLModel <MTLJSONSerializing>
+
+// Serialized into JSON as is.
+@property (nonatomic, strong, readonly) id value;
+
+@end
+
+@interface MTLCompactTestModel : MTLModel <MTLJSONSerializing>
+
+@property (nonatomic, copy) NSString *name;
+@property (nonatomic, strong) NSArray *tags;
+@property (nonatomic, strong) NSURL *URL;
+@property (nonatomic, assign) BOOL enabled;
+@property (nonatomic, assign) BOOL hidden;
+@property (nonatomic, assign) int8_t level;
+@property (nonatomic, assign) NSInteger count;
+@property (nonatomic, assign) double ratio;
+
+@end
+
+@interface MTLCompactSubclassTestModel : MTLCompactTestModel
+
+@property (nonatomic, copy) NSString *role;
+@property (nonatomic, assign) uint16_t rank;
+
+@end
+
+@interface MTLInterningTestModel : MTLModel <MTLJSONSerializing>
+
+@property (nonatomic, strong) MTLImmutableTestModel *owner;
+@property (nonatomic, copy) NSArray *members;
+
+@end
+
+@interface MTLIdentityTestModel : MTLModel <MTLJSONSerializing>
+
+@property (nonatomic, copy) NSString *identifier;
+@property (nonatomic, copy) NSString *name;
+@property (nonatomic, copy) NSArray *friends;
+
+@end
+
+@interface MTLChangeTrackingTestModel : MTLModel <MTLJSONSerializing>
+
+@property (nonatomic, copy) NSString *name;
+@property (nonatomic, assign) NSInteger count;
+@property (nonatomic, strong) MTLChangeTrackingTestModel *owner;
+@property (nonatomic, strong) NSMutableArray *tags;
+
+@end
+
+@interface MTLOmissionTestModel : MTLModel <MTLJSONSerializing>
+
+// The number of times the reverse transformer of `URL` has been invoked.
++ (NSUInteger)URLReverseTransformationCount;
+
+// Omitted if nil.
+@property (nonatomic, strong) NSURL *URL;
+
+// Omitted if nil or 0.
+@property (nonatomic, assign) NSInteger count;
+
+// Omitted if nil or equal to "default".
+@property (nonatomic, copy) NSString *mode;
+
+// Never omitted.
+@property (nonatomic, copy) NSString *note;
+
+// Omitted if its transformer produces NSNull, which it does for "unknown".
+@property (nonatomic, copy) NSString *status;
+
+@end
+
+@interface MTLNestedAdapterTestModel : MTLModel <MTLJSONSerializing>
+
+@property (nonatomic, copy) NSString *name;
+
+// Decoded by MTLUppercasingJSONAdapters.
+@property (nonatomic, strong) MTLNestedAdapterTestModel *child;
+@property (nonatomic, copy) NSArray *children;
+
+@end
+
+@interface MTLRaisingTestModel : MTLModel <MTLJSONSerializing>
+
+// The threads +classForParsingJSONDictionary: has been called on since the last
+// call to +resetParsingThreads.
++ (NSSet *)parsingThreads;
++ (void)resetParsingThreads;
+
+// +classForParsingJSONDictionary: raises an exception for JSON dictionaries
+// with a "raise" key, and -validate: raises one if this is "raise".
+@property (nonatomic, copy) NSString *name;
+
+@property (nonatomic, strong) MTLRaisingTestModel *child;
+@property (nonatomic, copy) NSArray *children;
+
+@end
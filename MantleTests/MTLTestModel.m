@@ -8,6 +8,7 @@
 
 #import "NSDictionary+MTLManipulationAdditions.h"
 
+#import "MTLTestJSONAdapter.h"
 #import "MTLTestModel.h"
 #import "NSDictionary+MTLMappingAdditions.h"
 
@@ -537,3 +538,227 @@ static NSUInteger modelVersion = 1;
 }
 
 @end
+
+@implementation MTLImmutableTestModel
+
++ (BOOL)isImmutable {
+	return YES;
+}
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [NSDictionary mtl_identityPropertyMapWithModel:self];
+}
+
+@end
+
+@implementation MTLImmutableWrapperTestModel
+
++ (BOOL)isImmutable {
+	return YES;
+}
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [NSDictionary mtl_identityPropertyMapWithModel:self];
+}
+
+@end
+
+@implementation MTLCompactTestModel
+
+@dynamic name;
+@dynamic tags;
+@dynamic URL;
+@dynamic enabled;
+@dynamic hidden;
+@dynamic level;
+@dynamic count;
+@dynamic ratio;
+
++ (BOOL)usesCompactStorage {
+	return YES;
+}
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [NSDictionary mtl_identityPropertyMapWithModel:self];
+}
+
+@end
+
+@implementation MTLCompactSubclassTestModel
+
+@dynamic role;
+@dynamic rank;
+
+@end
+
+@implementation MTLInterningTestModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [NSDictionary mtl_identityPropertyMapWithModel:self];
+}
+
++ (NSValueTransformer *)ownerJSONTransformer {
+	return [MTLJSONAdapter dictionaryTransformerWithModelClass:MTLImmutableTestModel.class];
+}
+
++ (NSValueTransformer *)membersJSONTransformer {
+	return [MTLJSONAdapter arrayTransformerWithModelClass:MTLImmutableTestModel.class];
+}
+
+@end
+
+@implementation MTLIdentityTestModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return @{
+		@"identifier": @"id",
+		@"name": @"name",
+		@"friends": @"friends"
+	};
+}
+
++ (NSString *)primaryKeyPropertyKey {
+	return @"identifier";
+}
+
++ (NSValueTransformer *)friendsJSONTransformer {
+	return [MTLJSONAdapter arrayTransformerWithModelClass:self];
+}
+
+@end
+
+@implementation MTLChangeTrackingTestModel
+
++ (BOOL)tracksChanges {
+	return YES;
+}
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [NSDictionary mtl_identityPropertyMapWithModel:self];
+}
+
++ (NSValueTransformer *)ownerJSONTransformer {
+	return [MTLJSONAdapter dictionaryTransformerWithModelClass:self];
+}
+
+@end
+
+static NSUInteger URLReverseTransformationCount = 0;
+
+@implementation MTLOmissionTestModel
+
++ (NSUInteger)URLReverseTransformationCount {
+	return URLReverseTransformationCount;
+}
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [NSDictionary mtl_identityPropertyMapWithModel:self];
+}
+
++ (MTLJSONOmissionPolicy)JSONOmissionPolicy {
+	return MTLJSONOmissionPolicyNil | MTLJSONOmissionPolicyDefaultValue;
+}
+
++ (NSDictionary *)JSONOmissionPoliciesByPropertyKey {
+	return @{
+		@"note": @(MTLJSONOmissionPolicyNone),
+		@"status": @(MTLJSONOmissionPolicyNull)
+	};
+}
+
++ (NSDictionary *)JSONDefaultValuesByPropertyKey {
+	return @{
+		@"count": @0,
+		@"mode": @"default"
+	};
+}
+
++ (NSValueTransformer *)URLJSONTransformer {
+	return [MTLValueTransformer
+		transformerUsingForwardBlock:^(NSString *string, BOOL *success, NSError **error) {
+			return [NSURL URLWithString:string];
+		}
+		reverseBlock:^(NSURL *URL, BOOL *success, NSError **error) {
+			URLReverseTransformationCount++;
+			return URL.absoluteString;
+		}];
+}
+
++ (NSValueTransformer *)statusJSONTransformer {
+	return [MTLValueTransformer
+		transformerUsingForwardBlock:^(NSString *string, BOOL *success, NSError **error) {
+			return string;
+		}
+		reverseBlock:^ id (NSString *string, BOOL *success, NSError **error) {
+			return [string isEqualToString:@"unknown"] ? NSNull.null : string;
+		}];
+}
+
+@end
+
+@implementation MTLNestedAdapterTestModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [NSDictionary mtl_identityPropertyMapWithModel:self];
+}
+
++ (NSValueTransformer *)childJSONTransformer {
+	return [MTLUppercasingJSONAdapter dictionaryTransformerWithModelClass:self];
+}
+
++ (NSValueTransformer *)childrenJSONTransformer {
+	return [MTLUppercasingJSONAdapter arrayTransformerWithModelClass:self];
+}
+
+@end
+
+@implementation MTLRaisingTestModel
+
+static NSMutableSet *parsingThreads = nil;
+
++ (NSSet *)parsingThreads {
+	@synchronized (self) {
+		return [parsingThreads copy] ?: [NSSet set];
+	}
+}
+
++ (void)resetParsingThreads {
+	@synchronized (self) {
+		parsingThreads = nil;
+	}
+}
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [NSDictionary mtl_identityPropertyMapWithModel:self];
+}
+
++ (Class)classForParsingJSONDictionary:(NSDictionary *)JSONDictionary {
+	@synchronized (MTLRaisingTestModel.class) {
+		if (parsingThreads == nil) parsingThreads = [NSMutableSet set];
+		[parsingThreads addObject:NSThread.currentThread];
+	}
+
+	if (JSONDictionary[@"raise"] != nil) {
+		[NSException raise:NSInternalInconsistencyException format:@"Raising for %@", JSONDictionary];
+	}
+
+	return self;
+}
+
++ (NSValueTransformer *)childJSONTransformer {
+	return [MTLJSONAdapter dictionaryTransformerWithModelClass:self];
+}
+
++ (NSValueTransformer *)childrenJSONTransformer {
+	return [MTLJSONAdapter arrayTransformerWithModelClass:self];
+}
+
+- (BOOL)validate:(NSError **)error {
+	if ([self.name isEqualToString:@"raise"]) {
+		[NSException raise:NSInternalInconsistencyException format:@"Raising for %@", self];
+	}
+
+	return [super validate:error];
+}
+
+@end